@@ -0,0 +1,110 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef BenchmarkUtils_h
+#define BenchmarkUtils_h
+
+#include <NaluEnv.h>
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <iosfwd>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace nalu_bench {
+
+struct BenchmarkOptions
+{
+  // number of elements per direction of the generated hex8 mesh used by the kernels
+  int meshSize_{16};
+
+  // number of elements in each master element batch
+  int numElements_{4096};
+
+  // timed repetitions; the fastest one is reported
+  int numRepeats_{5};
+
+  // polynomial order of the promoted HexN master elements
+  int polyOrder_{3};
+
+  // only run benchmarks whose name contains this string
+  std::string filter_;
+
+  bool selected(const std::string &name) const
+  {
+    return filter_.empty() || name.find(filter_) != std::string::npos;
+  }
+};
+
+struct BenchmarkResult
+{
+  std::string name_;
+  std::string path_;
+  double numElements_{0.0};
+  double seconds_{0.0};
+  double flops_{-1.0};
+  bool implemented_{true};
+};
+
+//==========================================================================
+// Class Definition
+//==========================================================================
+// BenchmarkReport - collects timings and prints the throughput table
+//==========================================================================
+class BenchmarkReport
+{
+public:
+  BenchmarkReport(MPI_Comm comm) : comm_(comm) {}
+
+  // collective; element and flop counts are summed and the slowest rank's time is used
+  void add(
+    const std::string &name,
+    const std::string &path,
+    double localElements,
+    double localFlops,
+    double seconds);
+
+  void add_not_implemented(
+    const std::string &name,
+    const std::string &path);
+
+  void print(std::ostream &out) const;
+
+  const std::vector<BenchmarkResult> &results() const { return results_; }
+
+private:
+  MPI_Comm comm_;
+  std::vector<BenchmarkResult> results_;
+};
+
+// best-of-n wall time of func, after one untimed warm-up call
+template<typename Func>
+double time_best_of(int numRepeats, Func func)
+{
+  func();
+
+  double best = std::numeric_limits<double>::max();
+  for ( int k = 0; k < std::max(numRepeats, 1); ++k ) {
+    MPI_Barrier(MPI_COMM_WORLD);
+    const double start = sierra::nalu::NaluEnv::self().nalu_time();
+    func();
+    best = std::min(best, sierra::nalu::NaluEnv::self().nalu_time() - start);
+  }
+  return best;
+}
+
+void run_master_element_benchmarks(const BenchmarkOptions &options, BenchmarkReport &report);
+void run_kernel_benchmarks(const BenchmarkOptions &options, BenchmarkReport &report);
+void run_assembly_benchmarks(const BenchmarkOptions &options, BenchmarkReport &report);
+
+} // namespace nalu_bench
+
+#endif
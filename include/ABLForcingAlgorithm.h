@@ -65,6 +65,15 @@ class Transfers;
  *
  * There are two optional sub-sections in `abl_forcing`: "momentum" and
  * "temperature".
+ *
+ * By default the planar averages are computed by transferring the fields onto
+ * the target parts, one nodeset per height. With `averaging_type:
+ * height_bins` the nodes of `from_target_part` that lie within
+ * `height_bin_tolerance` of a forcing height are binned once at
+ * initialization and averaged in place, weighted by their dual volume rather
+ * than counted equally as in the transfer mode. This mode is meant for meshes
+ * with horizontal node layers at the forcing heights and does not need target
+ * parts.
  */
 class ABLForcingAlgorithm
 {
@@ -82,6 +91,14 @@ public:
     NUM_ABL_FORCING_TYPES //!< Guard
   };
 
+  /**
+   * Ways of computing the planar averages for COMPUTED forcing
+   */
+  enum ABLAveragingTypes {
+    PLANAR_TRANSFER = 0,  //!< Transfer fields to sampling planes and average
+    HEIGHT_BINS = 1       //!< Average mesh nodes binned by height
+  };
+
   ABLForcingAlgorithm(Realm&, const YAML::Node&);
 
   ~ABLForcingAlgorithm();
@@ -99,6 +116,18 @@ public:
   //! terms at desired levels.
   void execute();
 
+  //! Compute the planar averages at the forcing heights
+  void compute_planar_means();
+
+  //! Planar average velocity at the momentum forcing heights [num_UHeights, 3]
+  inline const Array2D<double>& mean_velocity() const { return UmeanCalc_; }
+
+  //! Planar average density at the momentum forcing heights [num_UHeights]
+  inline const std::vector<double>& mean_density() const { return rhoMeanCalc_; }
+
+  //! Planar average temperature at the temperature forcing heights [num_THeights]
+  inline const std::vector<double>& mean_temperature() const { return TmeanCalc_; }
+
   //! Evaluate the ABL forcing source contribution at a node
   void eval_momentum_source(
     const double,        //!< Height of the node from terrain
@@ -149,6 +178,12 @@ private:
   //! on user input.
   void register_fields();
 
+  //! Register the per-node height bin indices on the from_target_part(s)
+  void register_height_bin_fields();
+
+  //! Assign each node to the forcing height it lies on, or -1
+  void compute_height_bins();
+
   //! Create transfer that handles mapping of velocity and temperature from
   //! fluidRealm to the planar nodesets.
   void create_transfers();
@@ -166,6 +201,9 @@ private:
 
   void calc_mean_temperature();
 
+  //! Dual volume weighted means at all heights in one pass over the nodes
+  void calc_height_binned_means();
+
   //! Reference to Realm
   Realm& realm_;
 
@@ -175,6 +213,16 @@ private:
   //! Temperature Forcing Source Type
   ABLForcingTypes tempSrcType_;
 
+  //! Planar averaging method
+  ABLAveragingTypes averagingType_;
+
+  //! Distance from a forcing height within which nodes are binned
+  double heightBinTolerance_;
+
+  //! Per-node index into velHeights_/tempHeights_; -1 for nodes on no plane
+  ScalarIntFieldType* velHeightBin_;
+  ScalarIntFieldType* tempHeightBin_;
+
   //! Relaxation factor for momentum sources
   double alphaMomentum_;
 
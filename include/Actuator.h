@@ -15,6 +15,7 @@
 // stk_mesh/base/fem
 #include <stk_mesh/base/Entity.hpp>
 #include <stk_mesh/base/Ghosting.hpp>
+#include <stk_mesh/base/Types.hpp>
 #include <stk_search/BoundingBox.hpp>
 #include <stk_search/IdentProc.hpp>
 #include <stk_search/SearchMethod.hpp>
@@ -66,6 +67,17 @@ public:
   // populate nodal field and output norms (if appropriate)
   virtual void execute() = 0;
 
+  // redo searches and ghosting after the mesh was repartitioned
+  virtual void reinitialize() { initialize(); }
+
+  // bring the ghosting in line with elemsToGhost by adding the new ghosts and
+  // removing the ones no longer requested; elemsToGhost is reduced to the new
+  // ghosts. Coordinates of all ghosts are refreshed for the fine search
+  static void update_ghosting_incrementally(
+    Realm &realm,
+    stk::mesh::Ghosting &ghosting,
+    stk::mesh::EntityProcVec &elemsToGhost);
+
 };
 
 } // namespace nalu
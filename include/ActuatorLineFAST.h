@@ -50,6 +50,11 @@ class ActuatorLineFASTPointInfo {
   ActuatorLineFASTPointInfo(
 			    size_t globTurbId, Point centroidCoords, double searchRadius, Coordinates epsilon, fast::ActuatorNodeType nType);
   ~ActuatorLineFASTPointInfo();
+
+  /** Re-seat this point at a new location, keeping the storage of nodeVec_ and isoParCoords_ */
+  void reset(
+    size_t globTurbId, Point centroidCoords, double searchRadius, Coordinates epsilon, fast::ActuatorNodeType nType);
+
   size_t globTurbId_; ///< Global turbine number.
   Point centroidCoords_; ///< The coordinates of the actuator point.
   double searchRadius_; ///< Elements within this search radius will be affected by this actuator point.
@@ -60,7 +65,7 @@ class ActuatorLineFASTPointInfo {
   fast::ActuatorNodeType nodeType_; ///< HUB, BLADE or TOWER - Defined by an enum.
 
   std::vector<double> isoParCoords_; ///< The isoparametric coordinates of the bestElem_.
-  std::set<stk::mesh::Entity> nodeVec_; ///< A list of nodes that are part of elements that lie within the searchRadius_ around the actuator point.
+  std::vector<stk::mesh::Entity> nodeVec_; ///< A sorted list of nodes that are part of elements that lie within the searchRadius_ around the actuator point.
 };
 
 /** The ActuatorLineFAST class couples Nalu with the third party library OpenFAST for actuator line simulations of wind turbines
@@ -79,7 +84,7 @@ class ActuatorLineFASTPointInfo {
 
  * 2) During the initialize phase - The processor containing the hub of each turbine is found
  *    through a search and assigned to be the one controlling OpenFAST for that turbine. All
- *    processors controlling > 0 turbines initialize OpenFAST, populate the map of ``ActuatorLinePointInfo``
+ *    processors controlling > 0 turbines initialize OpenFAST, populate the vector of ``ActuatorLinePointInfo``
  *    and initialize element searches for all the actuator points associated with the turbines. For every actuator point, the elements within a specified search radius are found and stored in the corresponding object of the ``ActuatorLinePointInfo`` class.
  *
  * 3) Elements are ghosted to the owning point rank. We tried the opposite approach of
@@ -96,7 +101,7 @@ class ActuatorLineFASTPointInfo {
  * 5) During the execute phase called every time step, we sample the velocity at each actuator
  *    point and pass it to OpenFAST. All the OpenFAST turbine models are advanced upto Nalu's
  *    next time step to get the body forces at the actuator points. We then iterate over the
- *    ``ActuatorLinePointInfoMap`` to assemble source terms. For each node \f$n\f$within the 
+ *    ``actuatorLinePointInfoVec_`` to assemble source terms. For each node \f$n\f$within the 
  *    search radius of an actuator point \f$k\f$, the ``spread_actuator_force_to_node_vec`` 
  *    function calculates the effective lumped body force by multiplying the actuator force 
  *    with the Gaussian projection at the node as \f$F_i^n = g(\vec{r}_i^n) \, F_i^k\f$.
@@ -131,13 +136,16 @@ class ActuatorLineFAST: public Actuator {
   // setup part creation and nodal field registration (after populate_mesh())
   void update();
 
+  // turbines stay on their processors; only the searches follow a rebalance
+  void reinitialize() { update(); }
+
   // determine processor bounding box in the mesh
   void populate_candidate_procs();
 
   // determine element bounding box in the mesh
   void populate_candidate_elements();
 
-  // fill in the map that will hold point and ghosted elements
+  // fill in the vector that will hold point and ghosted elements
   void create_actuator_line_point_info_map();
 
   // figure out the set of elements that belong in the custom ghosting data structure
@@ -218,7 +226,7 @@ class ActuatorLineFAST: public Actuator {
   // Spread the actuator force to a node vector
   void spread_actuator_force_to_node_vec(
     const int &nDim,
-    std::set<stk::mesh::Entity>& nodeVec,
+    const std::vector<stk::mesh::Entity>& nodeVec,
     const std::vector<double>& actuator_force,
     const double * actuator_node_coordinates,
     const stk::mesh::FieldBase & coordinates,
@@ -247,6 +255,7 @@ class ActuatorLineFAST: public Actuator {
   stk::mesh::Ghosting *actuatorLineGhosting_;  ///< custom ghosting
   uint64_t needToGhostCount_;  ///< how many elements to ghost?
   stk::mesh::EntityProcVec elemsToGhost_; ///< elements to ghost
+  bool incrementalGhosting_; ///< keep the ghosting across updates and only add/remove the elements that changed
 
   int tStepRatio_;  ///< Ratio of Nalu time step to FAST time step (dtNalu/dtFAST) - Should be an integral number
 
@@ -262,7 +271,7 @@ class ActuatorLineFAST: public Actuator {
 
   std::vector<ActuatorLineFASTInfo *> actuatorLineInfo_;   ///< vector of objects containing information for each turbine
 
-  std::map<size_t, ActuatorLineFASTPointInfo *> actuatorLinePointInfoMap_;  ///< map of point info objects
+  std::vector<ActuatorLineFASTPointInfo> actuatorLinePointInfoVec_;  ///< point info objects indexed by local point number; reused across updates
 
   // scratch space
   std::vector<double> ws_coordinates_;
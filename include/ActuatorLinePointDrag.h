@@ -39,6 +39,11 @@ class ActuatorLinePointDragPointInfo {
   ActuatorLinePointDragPointInfo(
     size_t localId, Point centroidCoords, double radius, double omega, double twoSigSq, double *velocity);
   ~ActuatorLinePointDragPointInfo();
+
+  // re-seat the point, keeping the node and isoparametric storage
+  void reset(
+    size_t localId, Point centroidCoords, double radius, double omega, double twoSigSq, double *velocity);
+
   size_t localId_;
   Point centroidCoords_;
   double radius_;
@@ -51,7 +56,7 @@ class ActuatorLinePointDragPointInfo {
   double velocity_[3];
 
   std::vector<double> isoParCoords_;
-  std::set<stk::mesh::Entity> nodeVec_;
+  std::vector<stk::mesh::Entity> nodeVec_;
 };
 
  class ActuatorLinePointDrag: public Actuator
@@ -177,7 +182,7 @@ public:
   // Spread the actuator force to a node vector
   void spread_actuator_force_to_node_vec(
       const int &nDim,
-      std::set<stk::mesh::Entity>& nodeVec,
+      const std::vector<stk::mesh::Entity>& nodeVec,
       const std::vector<double>& actuator_force,
       const double * actuator_node_coordinates,
       const stk::mesh::FieldBase & coordinates,
@@ -197,6 +202,9 @@ public:
   uint64_t needToGhostCount_;
   stk::mesh::EntityProcVec elemsToGhost_;
 
+  // keep the ghosting across searches and only add/remove the elements that changed
+  bool incrementalGhosting_;
+
   // local id for set of points
   uint64_t localPointId_;
 
@@ -219,8 +227,8 @@ public:
   // vector of averaging information
   std::vector<ActuatorLinePointDragInfo *> actuatorLineInfo_;
 
-  // map of point info objects
-  std::map<size_t, ActuatorLinePointDragPointInfo *> actuatorLinePointInfoMap_;
+  // point info objects indexed by local point id; reused across searches
+  std::vector<ActuatorLinePointDragPointInfo> actuatorLinePointInfoVec_;
 
   // scratch space
   std::vector<double> ws_coordinates_;
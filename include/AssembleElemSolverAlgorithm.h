@@ -19,6 +19,9 @@
 #include<CopyAndInterleave.h>
 #include<FieldTypeDef.h>
 
+#include <algorithm>
+#include <vector>
+
 namespace stk {
 namespace mesh {
 class Part;
@@ -30,6 +33,7 @@ namespace sierra{
 namespace nalu{
 
 class MasterElement;
+class ElementCondenser;
 
 int
 calculate_shared_mem_bytes_per_thread(int lhsSize, int rhsSize, int scratchIdsSize, int nDim,
@@ -49,6 +53,14 @@ public:
   virtual void initialize_connectivity();
   virtual void execute();
 
+  // accumulate the off-node-block element coupling into the linear system's
+  // matrix-free result vector; called from within the Belos operator apply
+  void apply_matrix_free_operator();
+
+  // back-substitute for the statically condensed interior nodes of the
+  // solution field once the skeleton system has been solved
+  void recover_condensed_interior(stk::mesh::FieldBase* field);
+
   template<typename LambdaFunction>
   void run_algorithm(stk::mesh::BulkData& bulk_data, LambdaFunction lambdaFunc)
   {
@@ -58,7 +70,57 @@ public:
 
    const int bytes_per_team = 0;
    const int bytes_per_thread = calculate_shared_mem_bytes_per_thread(lhsSize, rhsSize_, scratchIdsSize,
-                                                                    meta_data.spatial_dimension(), dataNeededByKernels_);
+                                                                    meta_data.spatial_dimension(), dataNeededByKernels_)
+                              + 2*(algScratchSize_*sizeof(double) + algIntScratchSize_*sizeof(int));
+
+   auto fill_simd_group = [&](SharedMemData& smdata, const stk::mesh::Entity* elems, int numSimdElems)
+   {
+       smdata.numSimdElems = numSimdElems;
+ 
+       for(int simdElemIndex=0; simdElemIndex<numSimdElems; ++simdElemIndex) {
+         stk::mesh::Entity element = elems[simdElemIndex];
+         smdata.elements[simdElemIndex] = element;
+         smdata.elemNodes[simdElemIndex] = bulk_data.begin_nodes(element);
+         fill_pre_req_data(dataNeededByKernels_, bulk_data, element,
+                           *smdata.prereqData[simdElemIndex], interleaveMEViews_);
+       }
+ 
+       copy_and_interleave(smdata.prereqData, numSimdElems, smdata.simdPrereqData, interleaveMEViews_);
+ 
+       if (!interleaveMEViews_) {
+         fill_master_element_views(dataNeededByKernels_, bulk_data, smdata.simdPrereqData);
+       }
+
+       lambdaFunc(smdata);
+   };
+
+   if (!elemColors_.empty()) {
+     // one launch per color; elements of a color share no nodes, so the scatter needs no atomics
+     const size_t simdGroupsPerTeam = 16;
+     for (const std::vector<stk::mesh::Entity>& colorElems : elemColors_) {
+       const size_t numElems = colorElems.size();
+       const size_t numSimdGroups = get_num_simd_groups(numElems);
+       const size_t numTeams = (numSimdGroups + simdGroupsPerTeam - 1)/simdGroupsPerTeam;
+
+       auto team_exec = sierra::nalu::get_team_policy(numTeams, bytes_per_team, bytes_per_thread);
+       Kokkos::parallel_for(team_exec, [&](const sierra::nalu::TeamHandleType& team)
+       {
+         SharedMemData smdata(team, bulk_data, dataNeededByKernels_, nodesPerEntity_, rhsSize_,
+                             algScratchSize_, algIntScratchSize_);
+
+         const size_t groupBegin = team.league_rank()*simdGroupsPerTeam;
+         const size_t groupEnd = std::min(groupBegin + simdGroupsPerTeam, numSimdGroups);
+
+         Kokkos::parallel_for(Kokkos::TeamThreadRange(team, groupBegin, groupEnd), [&](const size_t& groupIndex)
+         {
+           fill_simd_group(smdata, &colorElems[groupIndex*simdLen],
+                           get_length_of_next_simd_group(groupIndex, numElems));
+         });
+       });
+     }
+     return;
+   }
+
    stk::mesh::Selector elemSelector =
            meta_data.locally_owned_part()
          & stk::mesh::selectUnion(partVec_)
@@ -76,39 +138,56 @@ public:
                     "AssembleElemSolverAlgorithm expected nodesPerEntity_ = "
                     <<nodesPerEntity_<<", but b.topology().num_nodes() = "<<b.topology().num_nodes());
  
-     SharedMemData smdata(team, bulk_data, dataNeededByKernels_, nodesPerEntity_, rhsSize_);
+     SharedMemData smdata(team, bulk_data, dataNeededByKernels_, nodesPerEntity_, rhsSize_,
+                             algScratchSize_, algIntScratchSize_);
 
      const size_t bucketLen   = b.size();
      const size_t simdBucketLen = get_num_simd_groups(bucketLen);
  
      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, simdBucketLen), [&](const size_t& bktIndex)
      {
-       int numSimdElems = get_length_of_next_simd_group(bktIndex, bucketLen);
-       smdata.numSimdElems = numSimdElems;
- 
-       for(int simdElemIndex=0; simdElemIndex<numSimdElems; ++simdElemIndex) {
-         stk::mesh::Entity element = b[bktIndex*simdLen + simdElemIndex];
-         smdata.elemNodes[simdElemIndex] = bulk_data.begin_nodes(element);
-         fill_pre_req_data(dataNeededByKernels_, bulk_data, element,
-                           *smdata.prereqData[simdElemIndex], interleaveMEViews_);
-       }
- 
-       copy_and_interleave(smdata.prereqData, numSimdElems, smdata.simdPrereqData, interleaveMEViews_);
- 
-       if (!interleaveMEViews_) {
-         fill_master_element_views(dataNeededByKernels_, bulk_data, smdata.simdPrereqData);
-       }
+       const int numSimdElems = get_length_of_next_simd_group(bktIndex, bucketLen);
+       stk::mesh::Entity elems[simdLen];
+       for(int simdElemIndex=0; simdElemIndex<numSimdElems; ++simdElemIndex)
+         elems[simdElemIndex] = b[bktIndex*simdLen + simdElemIndex];
 
-       lambdaFunc(smdata);
+       fill_simd_group(smdata, elems, numSimdElems);
      });
    });
   }
 
+  void set_low_order_node_coupling();
+
+  void split_low_order_operator(SharedMemView<double**>& lhs, bool assembledPart);
+
+  void initialize_condensed_storage();
+
+  void apply_condensed_coeff(
+    ElementCondenser& condenser,
+    stk::mesh::Entity element,
+    const stk::mesh::Entity* elemNodes,
+    SharedMemData& smdata,
+    double* scratch);
+
   ElemDataRequests dataNeededByKernels_;
   stk::mesh::EntityRank entityRank_;
   unsigned nodesPerEntity_;
   int rhsSize_;
+  int algScratchSize_;
+  int algIntScratchSize_;
   const bool interleaveMEViews_;
+  bool matrixFree_;
+  std::vector<unsigned char> mfNodeCoupling_; // row-major node pairs assembled for the preconditioner
+
+  // element coloring for conflict-free threaded scatter; rebuilt with the graph
+  std::vector<std::vector<stk::mesh::Entity> > elemColors_;
+
+  // static condensation of promoted element interiors; the interior rows of
+  // each element system are kept for the back-substitution after the solve
+  bool condensed_;
+  std::vector<size_t> condensedElemIndex_; // indexed by element local_offset
+  std::vector<double> condensedLhs_;
+  std::vector<double> condensedRhs_;
 };
 
 } // namespace nalu
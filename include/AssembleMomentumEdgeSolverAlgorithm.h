@@ -11,6 +11,7 @@
 
 #include<SolverAlgorithm.h>
 #include<FieldTypeDef.h>
+#include<ElemColoring.h>
 
 namespace sierra{
 namespace nalu{
@@ -49,6 +50,9 @@ public:
 
   // peclet function specifics
   PecletFunction<double>* pecletFunction_;
+
+  // edge coloring for the threaded scatter
+  EntityColoring edgeColoring_;
 };
 
 } // namespace nalu
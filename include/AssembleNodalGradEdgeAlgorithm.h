@@ -11,6 +11,7 @@
 
 #include<Algorithm.h>
 #include<FieldTypeDef.h>
+#include<ElemColoring.h>
 
 namespace sierra{
 namespace nalu{
@@ -34,6 +35,8 @@ public:
   VectorFieldType *edgeAreaVec_;
   ScalarFieldType *dualNodalVolume_;
 
+  // edge coloring for the threaded scatter
+  EntityColoring edgeColoring_;
 };
 
 } // namespace nalu
@@ -11,6 +11,7 @@
 
 #include<SolverAlgorithm.h>
 #include<FieldTypeDef.h>
+#include<ElemColoring.h>
 
 namespace stk {
 namespace mesh {
@@ -57,6 +58,9 @@ public:
 
   // peclect function specifics
   PecletFunction<double>* pecletFunction_;
+
+  // edge coloring for the threaded scatter
+  EntityColoring edgeColoring_;
 };
 
 } // namespace nalu
@@ -0,0 +1,96 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef AsyncOutputManager_h
+#define AsyncOutputManager_h
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+/**
+ * Asynchronous results/restart output.
+ *
+ * Every output field is shadowed by a single-state staging field. At an output
+ * step the live field data is snapshotted into the staging fields and the
+ * database write, which the io broker performs from the staging fields, is
+ * handed to a dedicated i/o thread while the solver proceeds. A new snapshot
+ * only waits for writes queued at an earlier step; anything that modifies the
+ * mesh or otherwise uses the io library must call wait() first.
+ */
+class AsyncOutputManager
+{
+public:
+  AsyncOutputManager(Realm & realm);
+  ~AsyncOutputManager();
+
+  // declare the staging copy of a live field; must precede the meta data commit
+  stk::mesh::FieldBase *declare_staging_field(
+    const stk::mesh::FieldBase &liveField);
+
+  // staging copy of a live field, NULL if it has none
+  stk::mesh::FieldBase *staging_field(
+    const stk::mesh::FieldBase &liveField) const;
+
+  // snapshot live field data for the output at this step
+  void stage(
+    const std::vector<const stk::mesh::FieldBase *> &liveFields,
+    const int timeStepCount);
+
+  // queue a database write; runs in order on the i/o thread
+  void enqueue(std::function<void()> write);
+
+  // block until every queued write has completed
+  void wait();
+
+  // serializes all exodus/netcdf access across threads and realms
+  static std::mutex &io_library_mutex();
+
+  // whether the MPI library allows the i/o thread to communicate
+  static bool mpi_supports_async();
+
+private:
+  void drain_queue();
+
+  Realm &realm_;
+
+  std::map<const stk::mesh::FieldBase *, stk::mesh::FieldBase *> stagingFields_;
+  std::set<const stk::mesh::FieldBase *> stagedFields_;
+  int stagedStep_;
+
+  std::thread ioThread_;
+  std::mutex queueMutex_;
+  std::condition_variable queueCondition_;
+  std::deque<std::function<void()> > writeQueue_;
+  bool writeInProgress_;
+  bool shutdown_;
+  std::exception_ptr writeError_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -73,6 +73,37 @@ public:
   std::vector<unsigned> favreFieldSizeVec_;
   std::vector<unsigned> reynoldsFieldSizeVec_;
   std::vector<unsigned> resolvedFieldSizeVec_;
+
+  // fields read/written by the fused statistics kernel; resolved on first execute
+  bool fieldsResolved_{false};
+  stk::mesh::FieldBase *velocity_{nullptr};
+  stk::mesh::FieldBase *density_{nullptr};
+  stk::mesh::FieldBase *dudx_{nullptr};
+  stk::mesh::FieldBase *velocityRA_{nullptr};
+  stk::mesh::FieldBase *velocityFA_{nullptr};
+  stk::mesh::FieldBase *densityRA_{nullptr};
+  stk::mesh::FieldBase *resolvedTke_{nullptr};
+  stk::mesh::FieldBase *resolvedFavreTke_{nullptr};
+  stk::mesh::FieldBase *vorticity_{nullptr};
+  stk::mesh::FieldBase *qCriterion_{nullptr};
+  stk::mesh::FieldBase *lambdaCI_{nullptr};
+  stk::mesh::FieldBase *reynoldsStress_{nullptr};
+  stk::mesh::FieldBase *favreStress_{nullptr};
+  stk::mesh::FieldBase *resolvedStress_{nullptr};
+  stk::mesh::FieldBase *sfsStress_{nullptr};
+  stk::mesh::FieldBase *turbViscosity_{nullptr};
+  stk::mesh::FieldBase *turbKe_{nullptr};
+  stk::mesh::FieldBase *dualNodalVolume_{nullptr};
+  stk::mesh::FieldBase *temperature_{nullptr};
+  stk::mesh::FieldBase *temperatureResolvedFlux_{nullptr};
+  stk::mesh::FieldBase *temperatureVariance_{nullptr};
+  stk::mesh::FieldBase *temperatureSFSFlux_{nullptr};
+  stk::mesh::FieldBase *dhdx_{nullptr};
+  stk::mesh::FieldBase *specificHeat_{nullptr};
+
+  // model constants used by the sfs statistics
+  double sfsCi_{0.0};
+  double turbPrandtl_{1.0};
 };
 
 } // namespace nalu
@@ -15,6 +15,7 @@ namespace sierra{
 namespace nalu{
 
 class Realm;
+class MasterElementBatch;
 
 class ComputeGeometryBoundaryAlgorithm : public Algorithm
 {
@@ -23,9 +24,12 @@ public:
   ComputeGeometryBoundaryAlgorithm(
     Realm &realm,
     stk::mesh::Part *part);
-  virtual ~ComputeGeometryBoundaryAlgorithm() {}
+  virtual ~ComputeGeometryBoundaryAlgorithm();
 
   virtual void execute();
+
+  // bucket-wide geometry scratch; reused across steps
+  MasterElementBatch *meBatch_;
 };
 
 } // namespace nalu
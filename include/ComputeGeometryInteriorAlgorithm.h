@@ -18,6 +18,7 @@ namespace sierra{
 namespace nalu{
 
 class Realm;
+class MasterElementBatch;
 
 class ComputeGeometryInteriorAlgorithm : public Algorithm
 {
@@ -31,6 +32,9 @@ public:
   void execute();
 
   const bool assembleEdgeAreaVec_;
+
+  // bucket-wide geometry scratch; reused across steps
+  MasterElementBatch *meBatch_;
   
 };
 
@@ -0,0 +1,98 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef DataProbeBinaryWriter_h
+#define DataProbeBinaryWriter_h
+
+#include <mpi.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+/**
+ * Buffered, columnar binary time series for one data probe specification.
+ *
+ * Every rank registers the probes it owns and appends the values of their
+ * points at each output step. The steps are buffered and, every bufferSteps
+ * steps, gathered to a single writer rank that appends them to one file:
+ *
+ *   char[8] "NALUPRB1"
+ *   int32   nDim, numPoints, numFields
+ *   numFields x { int32 nameLength, char[nameLength] name, int32 fieldSize }
+ *   double  coordinates[numPoints][nDim]
+ *   per step: double time, then per field double values[numPoints][fieldSize]
+ *
+ * Points are ordered by probe ordinal, then by point along the probe. Records
+ * have a fixed size, so any step or field can be read with a single seek.
+ */
+class DataProbeBinaryWriter
+{
+public:
+  DataProbeBinaryWriter(
+    const std::string &fileName,
+    const int writerRank,
+    const int nDim,
+    const std::vector<std::pair<std::string, int> > &fieldInfo,
+    const int bufferSteps,
+    MPI_Comm comm);
+  ~DataProbeBinaryWriter();
+
+  // register a probe owned by this rank, before the first step; coordinates are nDim per point
+  void add_probe(
+    const int probeOrdinal,
+    const int numPoints,
+    const double *coordinates);
+
+  // values of this rank's points, in add_probe order, all field components
+  // per point; collective, as it flushes every bufferSteps steps
+  void append_step(
+    const double time,
+    const double *values);
+
+  // gather and write the buffered steps; collective
+  void flush();
+
+  int values_per_point() const { return valuesPerPoint_; }
+  int num_local_points() const { return numLocalPoints_; }
+
+private:
+  void gather_layout();
+  std::vector<char> header() const;
+  void open_file();
+
+  const std::string fileName_;
+  const int writerRank_;
+  const int nDim_;
+  const std::vector<std::pair<std::string, int> > fieldInfo_;
+  const int bufferSteps_;
+  MPI_Comm comm_;
+
+  int valuesPerPoint_;
+  int numLocalPoints_;
+  std::vector<int> localProbes_; // (ordinal, numPoints) pairs
+  std::vector<double> localCoordinates_;
+
+  std::vector<double> times_;
+  std::vector<double> buffer_;
+
+  // writer rank only: global layout
+  bool layoutGathered_;
+  int numGlobalPoints_;
+  std::vector<int> rankPointOffset_; // per rank, per local point: global point
+  std::vector<int> rankPointStart_;
+  std::vector<double> globalCoordinates_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
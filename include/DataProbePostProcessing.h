@@ -34,6 +34,7 @@ namespace stk {
 namespace sierra{
 namespace nalu{
 
+class DataProbeBinaryWriter;
 class Realm;
 class Transfer;
 class Transfers;
@@ -50,6 +51,7 @@ public:
   std::vector<int> processorId_;
   std::vector<int> numPoints_;
   std::vector<int> generateNewIds_;
+  std::vector<int> textFileOpened_;
   std::vector<Coordinates> tipCoordinates_;
   std::vector<Coordinates> tailCoordinates_;
   std::vector<std::vector<stk::mesh::Entity> > nodeVector_;
@@ -70,6 +72,12 @@ public:
   // homegeneous collection of fields over each specification
   std::vector<std::pair<std::string, std::string> > fromToName_;
   std::vector<std::pair<std::string, int> > fieldInfo_;
+
+  // fields of fieldInfo_, looked up once after the transfer is created
+  std::vector<const stk::mesh::FieldBase *> fieldVec_;
+
+  // binary output of all probes in this specification
+  DataProbeBinaryWriter *binaryWriter_;
 };
 
 class DataProbePostProcessing
@@ -109,8 +117,17 @@ public:
   // populate nodal field and output norms (if appropriate)
   void execute();
 
+  // create the binary writers and register the locally owned probes
+  void create_binary_writers();
+
   // output to a file
   void provide_output(const double currentTime);
+
+  // one text file per probe
+  void provide_text_output(const double currentTime);
+
+  // one buffered binary file per specification
+  void provide_binary_output(const double currentTime);
   
   // provide the inactive selector
   stk::mesh::Selector &get_inactive_selector();
@@ -124,6 +141,10 @@ public:
   // width for output
   int w_;
 
+  // text (one file per probe) or binary (one file per specification)
+  std::string outputFormat_;
+  int outputBufferSteps_;
+
   // xfer specifications
   std::string searchMethodName_;
   double searchTolerance_;
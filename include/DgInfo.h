@@ -16,6 +16,7 @@
 #include <stk_mesh/base/Entity.hpp>
 #include <stk_topology/topology.hpp>
 
+#include <cstdint>
 #include <vector>
 
 namespace sierra {
@@ -30,10 +31,14 @@ class MasterElement;
 //=============================================================================
 /**
  * * @par Description:
- * - class for halo stuff.
+ * - class for halo stuff; all gauss points of a nonconformal surface.
  *
  * @par Design Considerations:
- * -
+ * - structure of arrays indexed by the local gauss point id, grouped by
+ *   current face (face_begin/face_end); coordinate arrays are [ig*nDim+j].
+ * - opposing face ids found by the search are stored compressed,
+ *   [allOpposingFaceIdsOffset_[ig], allOpposingFaceIdsOffset_[ig+1]).
+ * - clear() keeps the capacity, so reconstruction does not reallocate.
  */
 //=============================================================================
 class DgInfo {
@@ -43,60 +48,91 @@ class DgInfo {
   // constructor and destructor
   DgInfo(
     int parallelRank,
+    const int nDim,
+    double searchTolerance);
+
+  ~DgInfo();
+
+  /* remove all faces and gauss points */
+  void clear();
+
+  /* append a current face with numGaussPoints gauss points */
+  void add_face(
     uint64_t globalFaceId,
-    uint64_t localGaussPointId,
-    int currentGaussPointId,
     stk::mesh::Entity currentFace,
     stk::mesh::Entity currentElement,
     const int currentFaceOrdinal,
     MasterElement *meFCCurrent,
-    MasterElement *meSCSurrent,
+    MasterElement *meSCSCurrent,
     stk::topology currentElementTopo,
-    const int nDim,
-    double searchTolerance);
-  
-  ~DgInfo();
+    const int numGaussPoints);
 
-  void dump_info();
+  /* prepare for a new search; keep the previous opposing ids when reusing */
+  void reset(const bool canReuse);
+
+  void dump_info(const size_t ig);
+
+  size_t num_faces() const { return faceOffset_.size() - 1; }
+  size_t num_gauss_points() const { return currentFace_.size(); }
+  size_t face_begin(const size_t iface) const { return faceOffset_[iface]; }
+  size_t face_end(const size_t iface) const { return faceOffset_[iface+1]; }
+
+  double *current_gauss_point_coords(const size_t ig) { return &currentGaussPointCoords_[ig*nDim_]; }
+  const double *current_gauss_point_coords(const size_t ig) const { return &currentGaussPointCoords_[ig*nDim_]; }
+  double *current_iso_par_coords(const size_t ig) { return &currentIsoParCoords_[ig*nDim_]; }
+  const double *current_iso_par_coords(const size_t ig) const { return &currentIsoParCoords_[ig*nDim_]; }
+  double *opposing_iso_par_coords(const size_t ig) { return &opposingIsoParCoords_[ig*nDim_]; }
+  const double *opposing_iso_par_coords(const size_t ig) const { return &opposingIsoParCoords_[ig*nDim_]; }
+
+  size_t num_opposing_face_ids(const size_t ig) const {
+    return allOpposingFaceIdsOffset_[ig+1] - allOpposingFaceIdsOffset_[ig]; }
 
   int parallelRank_;
-  uint64_t globalFaceId_;
-  uint64_t localGaussPointId_;
-  int currentGaussPointId_;
-
-  stk::mesh::Entity currentFace_;
-  stk::mesh::Entity currentElement_;
-  const int currentFaceOrdinal_;
-  MasterElement *meFCCurrent_;
-  MasterElement *meSCSCurrent_;
-  stk::topology currentElementTopo_;
-  
   int nDim_;
 
   const double bestXRef_;
-  double bestX_;
-  double nearestDistance_;
+  const double searchTolerance_;
   const double nearestDistanceSafety_;
 
-  int opposingFaceIsGhosted_;
+  // first gauss point of each current face; size is num_faces()+1
+  std::vector<size_t> faceOffset_;
+
+  // current side; fixed once constructed
+  std::vector<uint64_t> globalFaceId_;
+  std::vector<int> currentGaussPointId_;
+  std::vector<stk::mesh::Entity> currentFace_;
+  std::vector<stk::mesh::Entity> currentElement_;
+  std::vector<int> currentFaceOrdinal_;
+  std::vector<MasterElement *> meFCCurrent_;
+  std::vector<MasterElement *> meSCSCurrent_;
+  std::vector<stk::topology> currentElementTopo_;
+
+  // search state
+  std::vector<double> bestX_;
+  std::vector<double> nearestDistance_;
+
+  std::vector<int> opposingFaceIsGhosted_;
 
   // search provides opposing face
-  stk::mesh::Entity opposingFace_;
+  std::vector<stk::mesh::Entity> opposingFace_;
+
+  // global id of the opposing face; survives ghosting changes (0 before the first search)
+  std::vector<uint64_t> opposingFaceId_;
 
   // face:element relations provide connected element to opposing face
-  stk::mesh::Entity opposingElement_;
+  std::vector<stk::mesh::Entity> opposingElement_;
 
   // opposing element topo
-  stk::topology opposingElementTopo_;
+  std::vector<stk::topology> opposingElementTopo_;
 
   // for the opposing face, what is its ordinal?
-  int opposingFaceOrdinal_;
+  std::vector<int> opposingFaceOrdinal_;
 
   // master element for opposing face
-  MasterElement *meFCOpposing_;
+  std::vector<MasterElement *> meFCOpposing_;
 
   // master element for opposing face connected element
-  MasterElement *meSCSOpposing_;
+  std::vector<MasterElement *> meSCSOpposing_;
 
   // coordinates of gauss points on current face
   std::vector<double> currentGaussPointCoords_;
@@ -105,13 +141,15 @@ class DgInfo {
   std::vector<double> currentIsoParCoords_;
 
   // iso-parametric coordinates for gauss point on opposing face (-1:1)
-  std::vector<double> opposingIsoParCoords_;  
+  std::vector<double> opposingIsoParCoords_;
 
-  // possible reuse
+  // possible reuse; ids of gauss point ig are in [offset[ig], offset[ig+1])
   std::vector<uint64_t> allOpposingFaceIds_;
+  std::vector<size_t> allOpposingFaceIdsOffset_;
   std::vector<uint64_t> allOpposingFaceIdsOld_;
+  std::vector<size_t> allOpposingFaceIdsOffsetOld_;
 };
-  
+
 } // end sierra namespace
 } // end nalu namespace
 
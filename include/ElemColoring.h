@@ -0,0 +1,91 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef ElemColoring_h
+#define ElemColoring_h
+
+#include <KokkosInterface.h>
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+/** Greedy coloring of the entities in the given buckets such that no two
+ *  entities of the same color share a node
+ *
+ *  Entities of one color can therefore be scattered into the linear system
+ *  concurrently without atomics.
+ *
+ *  @param bulkData The mesh
+ *  @param buckets The (element) buckets to color
+ *  @param colors On output, colors[c] lists the entities assigned color c
+ */
+void color_entities_by_node(
+  const stk::mesh::BulkData & bulkData,
+  const stk::mesh::BucketVector & buckets,
+  std::vector<std::vector<stk::mesh::Entity> > & colors);
+
+/** Node-based coloring of a set of entities, cached until the next mesh
+ *  modification
+ */
+class EntityColoring
+{
+public:
+  EntityColoring() {}
+
+  const std::vector<std::vector<stk::mesh::Entity> > & colors(
+    const stk::mesh::BulkData & bulkData,
+    const stk::mesh::BucketVector & buckets);
+
+private:
+  size_t syncCount_{std::numeric_limits<size_t>::max()};
+  std::vector<std::vector<stk::mesh::Entity> > colors_;
+};
+
+/** Apply f(team, entities, numEntities) to chunks of each color in turn
+ *
+ *  Colors are processed one after the other, the chunks of a color
+ *  concurrently; f is expected to distribute its chunk over the team threads.
+ */
+template<typename TeamFunction>
+void colored_team_for_each(
+  const std::vector<std::vector<stk::mesh::Entity> > & colors,
+  const int bytesPerThread,
+  TeamFunction f)
+{
+  const size_t entitiesPerTeam = 128;
+  for ( const std::vector<stk::mesh::Entity> & color : colors ) {
+    const size_t numEntities = color.size();
+    const size_t numTeams = (numEntities + entitiesPerTeam - 1)/entitiesPerTeam;
+
+    auto team_exec = get_team_policy(numTeams, 0, bytesPerThread);
+    Kokkos::parallel_for(team_exec, [&](const TeamHandleType& team)
+    {
+      const size_t begin = team.league_rank()*entitiesPerTeam;
+      const size_t end = std::min(begin + entitiesPerTeam, numEntities);
+      f(team, &color[begin], end - begin);
+    });
+  }
+}
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
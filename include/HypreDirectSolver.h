@@ -59,6 +59,12 @@ public:
   //! Return the type of solver instance
   virtual PetraType getType() override { return PT_HYPRE; }
 
+  //! Attribute the bytes of the BoomerAMG hierarchy, if any, per level
+  virtual void report_memory(MemoryAccounting&, const std::string&) override;
+
+  //! Local bytes held by a ParCSR matrix (values, indices and offsets)
+  static double parcsr_bytes(HYPRE_ParCSRMatrix);
+
   //! Instance of the Hypre parallel matrix
   mutable HYPRE_ParCSRMatrix parMat_;
 
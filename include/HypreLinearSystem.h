@@ -19,7 +19,9 @@
 #include "krylov.h"
 #include "HYPRE.h"
 
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace sierra {
 namespace nalu {
@@ -33,6 +35,15 @@ namespace nalu {
  *  linear system. The HypreLinearSystem::solve method interfaces with
  *  sierra::nalu::HypreDirectSolver that is responsible for the actual solution
  *  of the system using the required solver and preconditioner combination.
+ *
+ *  The matrix is created once per linear system. The build*Graph calls record
+ *  the node connectivity of every algorithm, and finalizeLinearSystem sets all
+ *  of those entries (plus the diagonal of every owned row) to zero and
+ *  assembles the matrix, which fixes the sparsity pattern before any algorithm
+ *  runs. Subsequent zeroSystem calls reset the values in place and sumInto adds
+ *  the locally owned rows directly into the ParCSR diag/offd arrays. Only rows
+ *  owned by other ranks go through HYPRE_IJMatrixAddToValues, to be
+ *  communicated at assembly.
  */
 class HypreLinearSystem : public LinearSystem
 {
@@ -199,6 +210,8 @@ public:
   virtual void writeToFile(const char * filename, bool useOwned=true) {}
   virtual void writeSolutionToFile(const char * filename, bool useOwned=true) {}
 
+  virtual void report_memory(MemoryAccounting& acct, const std::string& prefix);
+
 protected:
   /** Prepare the instance for system construction
    *
@@ -220,6 +233,49 @@ protected:
   //! the STK field data instance.
   double copy_hypre_to_stk(stk::mesh::FieldBase*);
 
+  /** Locate the first numCols entries of idBuffer_ in the assembled matrix
+   *
+   *  Populates colBuffer_ with the local diag column (>= 0) or the encoded
+   *  offd column (-1 - offd index) of each global column, so that the rows of
+   *  one sumInto call share a single column lookup.
+   */
+  void map_columns(const HypreIntType numCols);
+
+  /** Add a row of values directly into the assembled ParCSR matrix
+   *
+   *  @param[in] localRow Row index relative to iLower_
+   *  @param[in] numCols Number of columns, mapped by map_columns
+   *  @param[in] vals Values to be added
+   */
+  void add_to_owned_row(
+    const HypreIntType localRow,
+    const HypreIntType numCols,
+    const double* vals);
+
+  //! Reset all entries of the assembled matrix to zero keeping the pattern
+  void zero_matrix_values();
+
+  /** Record the coupling of a set of nodes in the matrix pattern
+   *
+   *  Every node couples to all nodes of the set, i.e., the dense block that
+   *  sumInto adds for the same nodes.
+   */
+  void addConnections(
+    const stk::mesh::Entity* entities,
+    const size_t numEntities);
+
+  //! Record the nodes of the locally owned entities of the given rank
+  void buildConnectedNodeGraph(
+    stk::mesh::EntityRank rank,
+    const stk::mesh::PartVector& parts);
+
+  /** Assemble the recorded connectivity with zero values
+   *
+   *  Locally owned rows are set directly, rows owned by other ranks are sent
+   *  to their owner during the assembly.
+   */
+  void assemble_pattern();
+
 private:
   /** Flags indicating whether a particular row in the HYPRE matrix has been
    * filled or not.
@@ -271,6 +327,18 @@ private:
   //! Buffer for handling Global Row IDs for use in sumInto methods
   std::vector<HypreIntType> idBuffer_;
 
+  //! Node columns of the locally owned node rows, indexed from hypreILower_
+  std::vector<std::vector<HypreIntType>> ownedConnections_;
+
+  //! Node columns of the node rows owned by other ranks
+  std::unordered_map<HypreIntType, std::vector<HypreIntType>> sharedConnections_;
+
+  //! Buffer of diag/offd column locations of idBuffer_ (see map_columns)
+  std::vector<HypreIntType> colBuffer_;
+
+  //! The ParCSR object of mat_, valid once the matrix has been assembled
+  HYPRE_ParCSRMatrix parMat_{nullptr};
+
   //! The lowest row owned by this MPI rank
   HypreIntType iLower_;
   //! The highest row owned by this MPI rank
@@ -287,6 +355,9 @@ private:
   //! Flag indicating whether the linear system has been initialized
   bool systemInitialized_{false};
 
+  //! Flag indicating that mat_ has been assembled and its pattern is fixed
+  bool matrixAssembled_{false};
+
   //! Flag indicating that sumInto should check to see if rows must be skipped
   bool checkSkippedRows_{false};
 
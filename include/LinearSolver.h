@@ -11,6 +11,7 @@
 
 #include <LinearSolverTypes.h>
 #include <LinearSolverConfig.h>
+#include <PreconditionerReusePolicy.h>
 
 #include <LinearSolverTypes.h>
 
@@ -54,6 +55,7 @@ namespace nalu{
 
 class LinearSolvers;
 class Simulation;
+class MemoryAccounting;
 
 const LocalOrdinal INVALID = std::numeric_limits<LocalOrdinal>::max();
 
@@ -141,7 +143,11 @@ class LinearSolver
         config_(config),
         recomputePreconditioner_(config->recomputePreconditioner()),
         reusePreconditioner_(config->reusePreconditioner()),
-        timerPrecond_(0.0)
+        timerPrecond_(0.0),
+        reusePolicy_(
+          config->adaptivePreconditionerReuse(),
+          config->reuseIterationGrowth(),
+          config->reuseMaxSolves())
     {}
     virtual ~LinearSolver() {}
 
@@ -155,6 +161,11 @@ class LinearSolver
    */
     virtual void destroyLinearSolver() = 0;
 
+  /** Attribute the bytes held by the preconditioner to entries below prefix;
+   *  every rank must add the same entries
+   */
+    virtual void report_memory(MemoryAccounting&, const std::string&) {}
+
     Simulation* root();
     LinearSolvers* parent();
     LinearSolvers* linearSolvers_;
@@ -166,6 +177,9 @@ class LinearSolver
   double timerPrecond_;
   bool activateMueLu_{false};
 
+  //! Decides between rebuilding, refreshing, or freezing the preconditioner
+  PreconditionerReusePolicy reusePolicy_;
+
   public:
   //! Flag indicating whether the preconditioner is recomputed on each invocation
   bool & recomputePreconditioner() {return recomputePreconditioner_;}
@@ -178,6 +192,9 @@ class LinearSolver
   //! Get the preconditioner timer for the last invocation
   double get_timer_precond() { return timerPrecond_;}
 
+  //! Preconditioner reuse decisions and iteration history
+  const PreconditionerReusePolicy& reuse_policy() const { return reusePolicy_; }
+
   //! Flag indicating whether the user has activated MueLU
   bool& activeMueLu() { return activateMueLu_; }
 
@@ -213,6 +230,24 @@ class TpetraLinearSolver : public LinearSolver
 
     virtual void destroyLinearSolver() override;
 
+    virtual void report_memory(MemoryAccounting& acct, const std::string& prefix) override;
+
+  /** Replace the assembled matrix with a matrix-free operator for the Krylov
+   *  iteration; the assembled matrix continues to feed the preconditioner
+   *
+   *  @param[in] op The operator applied in place of the assembled matrix
+   */
+    void setMatrixFreeOperator(Teuchos::RCP<LinSys::Operator> op);
+
+  //! Flag indicating whether the user has activated the matrix-free element operator
+    bool activeMatrixFree() const { return config_->matrixFreeOperator(); }
+
+  //! Flag indicating whether the linear system caches its scatter offsets
+    bool activeAssemblyPlan() const { return config_->cachedAssemblyPlan(); }
+
+  //! Flag indicating whether promoted element interiors are condensed out of the system
+    bool activeStaticCondensation() const { return config_->staticCondensation(); }
+
   //! Initialize the MueLU preconditioner before solve
     void setMueLu();
 
@@ -251,6 +286,7 @@ class TpetraLinearSolver : public LinearSolver
     Teuchos::RCP<LinSys::SolverManager> solver_;
     Teuchos::RCP<LinSys::Preconditioner> preconditioner_;
     Teuchos::RCP<MueLu::TpetraOperator<SC,LO,GO,NO> > mueluPreconditioner_;
+    Teuchos::RCP<LinSys::Operator> matrixFreeOperator_;
     Teuchos::RCP<LinSys::MultiVector> coords_;
 
     std::string preconditionerType_;
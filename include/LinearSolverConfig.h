@@ -50,6 +50,24 @@ public:
   inline bool reusePreconditioner() const
   { return reusePreconditioner_; }
 
+  inline bool adaptivePreconditionerReuse() const
+  { return adaptivePreconditionerReuse_; }
+
+  inline double reuseIterationGrowth() const
+  { return reuseIterationGrowth_; }
+
+  inline int reuseMaxSolves() const
+  { return reuseMaxSolves_; }
+
+  inline bool matrixFreeOperator() const
+  { return matrixFreeOperator_; }
+
+  inline bool cachedAssemblyPlan() const
+  { return cachedAssemblyPlan_; }
+
+  inline bool staticCondensation() const
+  { return staticCondensation_; }
+
   std::string get_method() const
   {return method_;}
 
@@ -77,7 +95,13 @@ protected:
 
   bool recomputePreconditioner_{true};
   bool reusePreconditioner_{false};
+  bool adaptivePreconditionerReuse_{false};
+  double reuseIterationGrowth_{1.5};
+  int reuseMaxSolves_{0};
   bool writeMatrixFiles_{false};
+  bool matrixFreeOperator_{false};
+  bool cachedAssemblyPlan_{false};
+  bool staticCondensation_{false};
 };
 
 class TpetraLinearSolverConfig : public LinearSolverConfig
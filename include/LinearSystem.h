@@ -36,6 +36,8 @@ namespace nalu{
 class EquationSystem;
 class Realm;
 class LinearSolver;
+class AssembleElemSolverAlgorithm;
+class MemoryAccounting;
 
 class LinearSystem
 {
@@ -74,6 +76,57 @@ public:
    */
   virtual void buildDirichletNodeGraph(const std::vector<stk::mesh::Entity>&) {}
 
+  /** Process element nodes for matrix-free element assembly
+   *
+   *  Only a low-order part of the element matrices is assembled: the
+   *  node-diagonal blocks and the node pairs flagged in nodeCoupling
+   *  (row-major, nodesPerElement^2), e.g. the (sub-)element edges. The
+   *  remaining coupling is applied through the matrix-free element operator.
+   *  Linear systems without matrix-free support fall back to the full
+   *  elem->node graph.
+   */
+  virtual void buildLowOrderElemToNodeGraph(
+    const stk::mesh::PartVector & parts,
+    const std::vector<unsigned char> & /* nodeCoupling */)
+  { buildElemToNodeGraph(parts); }
+
+  //! Flag indicating whether element algorithms are applied matrix-free
+  virtual bool matrixFreeActive() const { return false; }
+
+  /** Register an element algorithm whose non-assembled coupling is applied
+   *  matrix-free, see sierra::nalu::MatrixFreeElemOperator
+   */
+  virtual void register_matrix_free_algorithm(AssembleElemSolverAlgorithm*) {}
+
+  /** Accumulate the product of the matrix-free (non-assembled) part of an
+   *  element matrix with the current matrix-free input vector
+   *
+   *  @param numEntities Number of nodes for the element
+   *  @param entities The element nodes
+   *  @param lhs The matrix-free part of the element matrix (numEntities*numDof)^2
+   */
+  virtual void applyElemOperator(
+    unsigned numEntities,
+    const stk::mesh::Entity* entities,
+    const SharedMemView<const double**> & lhs);
+
+  /** Process the skeleton (non-interior) nodes of promoted elements whose
+   *  interior nodes are statically condensed out of the linear system
+   *
+   *  Linear systems without condensation support fall back to the full
+   *  elem->node graph.
+   */
+  virtual void buildCondensedElemToNodeGraph(const stk::mesh::PartVector & parts)
+  { buildElemToNodeGraph(parts); }
+
+  //! Flag indicating whether promoted element interiors are condensed out of the system
+  virtual bool staticCondensationActive() const { return false; }
+
+  /** Register an element algorithm that condenses its element matrices; the
+   *  algorithm recovers the interior nodes after every solve
+   */
+  virtual void register_condensed_algorithm(AssembleElemSolverAlgorithm*) {}
+
   // Matrix Assembly
   virtual void zeroSystem()=0;
 
@@ -98,6 +151,35 @@ public:
     const char *trace_tag=0
     )=0;
 
+  /** Assemble the contribution of a mesh object (element, edge or face)
+   *
+   *  Linear systems that cache the matrix offsets of the mesh object's nodes
+   *  (see TpetraLinearSystem) skip the per-call sort and column search; the
+   *  default simply forwards to the node-based sumInto.
+   *
+   *  @param meshObj The element/edge/face whose nodes are given by entities
+   */
+  virtual void sumInto(
+      stk::mesh::Entity meshObj,
+      unsigned numEntities,
+      const stk::mesh::Entity* entities,
+      const SharedMemView<const double*> & rhs,
+      const SharedMemView<const double**> & lhs,
+      const SharedMemView<int*> & localIds,
+      const SharedMemView<int*> & sortPermutation,
+      const char * trace_tag)
+  { sumInto(numEntities, entities, rhs, lhs, localIds, sortPermutation, trace_tag); }
+
+  virtual void sumInto(
+    stk::mesh::Entity meshObj,
+    const std::vector<stk::mesh::Entity> & sym_meshobj,
+    std::vector<int> &scratchIds,
+    std::vector<double> &scratchVals,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0)
+  { sumInto(sym_meshobj, scratchIds, scratchVals, rhs, lhs, trace_tag); }
+
   virtual void applyDirichletBCs(
     stk::mesh::FieldBase * solutionField,
     stk::mesh::FieldBase * bcValuesField,
@@ -126,6 +208,10 @@ public:
 
   virtual void writeToFile(const char * filename, bool useOwned=true)=0;
   virtual void writeSolutionToFile(const char * filename, bool useOwned=true)=0;
+
+  // attribute the bytes of the graph, matrix, vectors and preconditioner
+  // to entries below prefix; every rank must add the same entries
+  virtual void report_memory(MemoryAccounting & /* acct */, const std::string & /* prefix */) {}
   unsigned numDof() const { return numDof_; }
   const int & linearSolveIterations() {return linearSolveIterations_; }
   const double & linearResidual() {return linearResidual_; }
@@ -135,6 +221,9 @@ public:
   const std::string name() { return eqSysName_; }
   bool & recomputePreconditioner() {return recomputePreconditioner_;}
   bool & reusePreconditioner() {return reusePreconditioner_;}
+  //! Flag indicating whether sumInto uses atomic adds; cleared while a colored
+  //! (conflict-free) element assembly is in progress
+  bool & atomicScatter() {return atomicScatter_;}
   double get_timer_precond();
   void zero_timer_precond();
 
@@ -162,6 +251,7 @@ protected:
   double scaledNonLinearResidual_;
   bool recomputePreconditioner_;
   bool reusePreconditioner_;
+  bool atomicScatter_;
 
 public:
   bool provideOutput_;
@@ -0,0 +1,146 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef LoadRebalancer_h
+#define LoadRebalancer_h
+
+#include <stk_mesh/base/Entity.hpp>
+
+#include <string>
+#include <vector>
+
+namespace YAML {
+class Node;
+}
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+/** Measured-cost repartitioning of a realm's elements during a run
+ *
+ *  Every element carries a cost model built from its physics work items:
+ *  the nodes of the element (higher-order topologies cost more), the
+ *  nonconformal gauss points on its faces, the wall-function integration
+ *  points on its boundary faces, the overset orphan nodes it donates to and
+ *  whether it receives actuator source. The per-item costs start from fixed
+ *  estimates and are fitted, over all ranks, to the assembly, property and
+ *  actuator time each rank spent since the last check.
+ *
+ *  When the measured max/avg work time exceeds the user tolerance, the
+ *  weighted element centroids are partitioned with Zoltan2 and elements,
+ *  together with the nodes and sides they leave behind, change owner.
+ *  Field data migrates with the entities; the realm rebuilds edges,
+ *  geometry, searches and linear systems afterwards.
+ */
+class LoadRebalancer
+{
+public:
+  enum CostTerm {
+    ELEMENT_NODES = 0,
+    NONCONFORMAL_IPS,
+    WALL_FUNCTION_IPS,
+    OVERSET_DONORS,
+    ACTUATOR_ELEMENTS,
+    NUM_COST_TERMS
+  };
+
+  LoadRebalancer(Realm &realm);
+  ~LoadRebalancer();
+
+  //! Read the rebalance block of a realm
+  void load(const YAML::Node &y_node);
+
+  //! Check the realm options and start the first measurement interval
+  void initialize();
+
+  //! The user interval has elapsed
+  bool is_due(const int timeStepCount) const;
+
+  //! Close the measurement interval; true when the imbalance warrants a rebalance
+  bool needs_rebalance();
+
+  //! Partition the weighted elements and migrate them; edges must be deleted
+  void rebalance();
+
+  //! Fold the work timed since the last call into the private total; call
+  //! before anything resets the equation system timers
+  void accumulate_work_time();
+
+  //! Add one rank's item totals and work time to the least-squares normal
+  //! equations; system holds [M (n*n), b (n), total time]
+  static void add_to_normal_system(
+    const std::vector<double> &costSums,
+    const double workTime,
+    std::vector<double> &system);
+
+  //! Solve the prior-regularized normal equations for the cost per item,
+  //! relative to one element node; false keeps costPerTerm unchanged
+  static bool fit_cost_model(
+    const std::vector<double> &system,
+    const std::vector<double> &globalCostSums,
+    const std::vector<double> &priorCost,
+    const double priorWeight,
+    std::vector<double> &costPerTerm);
+
+  //! New owner of a node or side given the destinations of its elements
+  //! (-1 for elements owned elsewhere); -1 when it stays
+  static int migrated_owner(
+    const int *elemDestinations,
+    const int numElements,
+    const int myRank);
+
+  Realm &realm_;
+
+  int frequency_;
+  std::string method_;
+  double imbalanceTolerance_;
+  double partitionTolerance_;
+  bool measuredWeights_;
+  int numRebalances_;
+
+private:
+  double local_work_time();
+
+  void compute_element_costs(
+    std::vector<stk::mesh::Entity> &elements,
+    std::vector<double> &costTerms);
+
+  void calibrate_cost_model(
+    const std::vector<double> &localCostSums,
+    std::vector<double> &costPerTerm);
+
+  void partition(
+    const std::vector<stk::mesh::Entity> &elements,
+    const std::vector<double> &weights,
+    std::vector<int> &destinations);
+
+  void migrate(
+    const std::vector<stk::mesh::Entity> &elements,
+    const std::vector<int> &destinations);
+
+  // a priori cost of one item of each term, relative to one element node
+  std::vector<double> priorCost_;
+
+  // relative weight pulling the fitted costs towards priorCost_
+  const double priorWeight_;
+
+  double lastWorkTime_;
+  double intervalWorkTime_;
+
+  // work time since the start of the run; the equation timers are reset by
+  // the timing report, so they are sampled into this total
+  double workTime_;
+  std::vector<double> lastTimerValues_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
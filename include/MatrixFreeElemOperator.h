@@ -0,0 +1,65 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef MatrixFreeElemOperator_h
+#define MatrixFreeElemOperator_h
+
+#include <LinearSolverTypes.h>
+
+#include <Teuchos_RCP.hpp>
+#include <Tpetra_Operator.hpp>
+
+namespace sierra{
+namespace nalu{
+
+class TpetraLinearSystem;
+
+/** Tpetra operator that applies y = A*x with the element contributions
+ *  evaluated on the fly
+ *
+ *  The assembled matrix of the owning TpetraLinearSystem holds the
+ *  contributions of non-element algorithms and a low-order part of the
+ *  element matrices: the node-diagonal blocks and the (sub-)element edge
+ *  couplings, with the remaining entries lumped onto the diagonal blocks.
+ *  The complement is recomputed by the element kernels on each application
+ *  and never stored. The assembled matrix is an edge-stencil operator with
+ *  the row sums of the full one and doubles as the preconditioner matrix.
+ */
+class MatrixFreeElemOperator : public LinSys::Operator
+{
+public:
+  MatrixFreeElemOperator(
+    TpetraLinearSystem &linsys,
+    Teuchos::RCP<const LinSys::Map> ownedRowsMap);
+
+  virtual ~MatrixFreeElemOperator() {}
+
+  Teuchos::RCP<const LinSys::Map> getDomainMap() const override
+  { return ownedRowsMap_; }
+
+  Teuchos::RCP<const LinSys::Map> getRangeMap() const override
+  { return ownedRowsMap_; }
+
+  void apply(
+    const LinSys::MultiVector &x,
+    LinSys::MultiVector &y,
+    Teuchos::ETransp mode = Teuchos::NO_TRANS,
+    LinSys::Scalar alpha = Teuchos::ScalarTraits<LinSys::Scalar>::one(),
+    LinSys::Scalar beta = Teuchos::ScalarTraits<LinSys::Scalar>::zero()) const override;
+
+  bool hasTransposeApply() const override { return false; }
+
+private:
+  TpetraLinearSystem &linsys_;
+  Teuchos::RCP<const LinSys::Map> ownedRowsMap_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -0,0 +1,61 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef MemoryAccounting_h
+#define MemoryAccounting_h
+
+#include <mpi.h>
+
+#include <map>
+#include <ostream>
+#include <string>
+
+namespace sierra{
+namespace nalu{
+
+/** Attribution of allocated bytes to the subsystems of a realm
+ *
+ *  Entries are '/' separated paths whose first component is the category,
+ *  e.g., "fields/velocity" or "linear_system/MomentumEQS/matrix". Every rank
+ *  must add the same set of entries (zero where nothing is allocated) so
+ *  that the report can be reduced entry by entry.
+ *
+ *  Fields are filed under "fields/" unless a group was registered for them,
+ *  e.g., post-processing fields under "post_processing/<owner>/".
+ */
+class MemoryAccounting
+{
+public:
+  MemoryAccounting() {}
+
+  //! Accumulate bytes into an entry
+  void add(const std::string &name, double bytes);
+
+  //! Drop all entries; field groups are kept
+  void clear();
+
+  //! File a field under the given category path instead of "fields"
+  void set_field_group(const std::string &fieldName, const std::string &group);
+
+  //! Category path of a field
+  std::string field_group(const std::string &fieldName) const;
+
+  //! Reduce over ranks and print per-entry and per-category sum/min/max on rank 0
+  void report(std::ostream &out, MPI_Comm comm) const;
+
+  const std::map<std::string, double> & entries() const { return entries_; }
+
+private:
+  std::map<std::string, double> entries_;
+  std::map<std::string, std::string> fieldGroups_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -12,6 +12,7 @@
 #include <mpi.h>
 #include <fstream>
 #include <streambuf>
+#include <string>
 
 namespace sierra{
 namespace nalu{
@@ -37,6 +38,8 @@ class NaluEnv
   std::ostream *naluLogStream_;
   std::ostream *naluParallelStream_;
   bool parallelLog_;
+  bool realmLog_;
+  std::string naluLogName_;
   
   NaluEmptyStreamBuffer naluEmptyStreamBuffer_;
   std::filebuf naluStreamBuffer_;
@@ -49,6 +52,7 @@ class NaluEnv
   int parallel_size();
   int parallel_rank();
   void set_log_file_stream(std::string naluLogName, bool pprint = false);
+  void set_realm_log_file_stream(const std::string &realmName);
   void close_log_file_stream();
   double nalu_time();
 };
@@ -333,9 +333,11 @@ struct NonConformalUserData : public UserData {
   bool clipIsoParametricCoords_;
   double searchTolerance_;
   bool dynamicSearchTolAlg_;
+  bool rotationPredictedSearch_;
   NonConformalUserData()
     : UserData(),
-    searchMethodName_("na"), expandBoxPercentage_(0.0), clipIsoParametricCoords_(false), searchTolerance_(1.0e-16), dynamicSearchTolAlg_(false)
+    searchMethodName_("na"), expandBoxPercentage_(0.0), clipIsoParametricCoords_(false), searchTolerance_(1.0e-16), dynamicSearchTolAlg_(false),
+    rotationPredictedSearch_(false)
   {}
 };
 
@@ -14,6 +14,7 @@
 //==============================================================================
 
 #include <master_element/MasterElement.h>
+#include <DgInfo.h>
 
 // stk
 #include <stk_mesh/base/Part.hpp>
@@ -36,7 +37,6 @@ namespace sierra {
 namespace nalu {
 
 class Realm;
-class DgInfo;
 
 typedef stk::search::IdentProc<uint64_t,int>  theKey;
 typedef stk::search::Point<double> Point;
@@ -72,22 +72,21 @@ class NonConformalInfo {
     const bool clipIsoParametricCoords,
     const double searchTolerance,
     const bool   dynamicSearchTolAlg,
+    const bool rotationPredictedSearch,
     const std::string debugName);
 
   ~NonConformalInfo();
 
-  /* delete dgInfoVec_ */
-  void delete_dgInfo();
-
-  /* perform initialization such as dgInfoVec creation and search point/boxes */
+  /* perform initialization such as dgInfo construction and search point/boxes */
   void initialize();
   
-  /* perform the 'new' */
+  /* fill dgInfo_ with the gauss points of the current surface */
   void construct_dgInfo();
 
   void reset_dgInfo();
   void construct_bounding_points();
   void construct_bounding_boxes();
+  void predict_opposing_faces();
   void determine_elems_to_ghost();
   void complete_search();
   void provide_diagnosis();
@@ -114,6 +113,9 @@ class NonConformalInfo {
   /* allow for dynamic search tolerance algorithm where search tolerance is used as point radius from isInElem */
   const bool dynamicSearchTolAlg_;
 
+  /* try last step's opposing face (and neighbors reachable by the mesh rotation) before the coarse search */
+  const bool rotationPredictedSearch_;
+
   /* does the realm have mesh motion */
   const bool meshMotion_;
 
@@ -124,17 +126,27 @@ class NonConformalInfo {
   std::vector<boundingSphere>     boundingSphereVec_;
   std::vector<boundingElementBox> boundingFaceElementBoxVec_;
 
-  /* vector of DgInfo */
-  std::vector<std::vector<DgInfo *> > dgInfoVec_;
+  /* gauss point data for the current surface; storage is reused across steps */
+  DgInfo dgInfo_;
 
   /* save off product of search */
   std::vector<std::pair<theKey, theKey> > searchKeyPair_;
 
+  /* gauss point:opposing face pairs resolved by the predicted fine search */
+  std::vector<std::pair<theKey, theKey> > predictedKeyPair_;
+
+  /* predictions needing more than this many face neighbor rings go to the coarse search */
+  const int maxPredictionRings_;
+
   private :
   void delete_range_points_found(std::vector<boundingSphere>                 &boundingSphereVec,
                                  const std::vector<std::pair<theKey,theKey>> &searchKeyPair) const;
   void repeat_search_if_needed  (const std::vector<boundingSphere>           &boundingSphereVec,
                                  std::vector<std::pair<theKey,theKey>>       &searchKeyPair) const;
+  void gather_neighbor_faces    (const stk::mesh::Entity                     face,
+                                 const int                                   numRings,
+                                 std::vector<stk::mesh::Entity>              &candidateFaces) const;
+  void request_predicted_ghosts ();
 };
 
 } // end sierra namespace
@@ -16,9 +16,11 @@
 // stk
 #include <stk_mesh/base/Part.hpp>
 #include <stk_mesh/base/Ghosting.hpp>
+#include <stk_mesh/base/Types.hpp>
 
 #include <vector>
 #include <map>
+#include <utility>
 
 namespace sierra {
 namespace nalu {
@@ -54,6 +56,10 @@ class NonConformalManager {
 
   void initialize();
 
+  /* refresh the current:opposing element couplings found by the last search;
+     returns true when they differ from those of the previous call */
+  bool update_graph_connectivity();
+
   Realm &realm_;
   const bool ncAlgDetailedOutput_;
   const bool ncAlgCoincidentNodesErrorCheck_;
@@ -71,6 +77,9 @@ class NonConformalManager {
 
   std::vector<int> ghostCommProcs_;
 
+  /* sorted current:opposing element id pairs that contribute to the linear system graph */
+  std::vector<std::pair<stk::mesh::EntityId, stk::mesh::EntityId> > graphConnectivity_;
+
   private:
 
   void manage_ghosting(std::vector<stk::mesh::EntityKey>& recvGhostsToRemove);
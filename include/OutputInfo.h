@@ -63,6 +63,10 @@ public:
   int restartCompressionLevel_;
   bool restartCompressionShuffle_;
 
+  // write from a staged snapshot on an i/o thread
+  bool outputAsync_;
+  bool restartAsync_;
+
   std::pair<bool, double> userWallTimeResults_;
   std::pair<bool, double> userWallTimeRestart_;
 
@@ -0,0 +1,92 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef PreconditionerReusePolicy_h
+#define PreconditionerReusePolicy_h
+
+#include <mpi.h>
+
+namespace sierra{
+namespace nalu{
+
+/** Decides, before every linear solve, whether the preconditioner is rebuilt
+ *  from scratch, numerically refreshed on the existing structure, or applied
+ *  as-is.
+ *
+ *  Without adaptivity the decision follows the static
+ *  `recompute_preconditioner` and `reuse_preconditioner` flags. With
+ *  adaptivity a full rebuild is requested only once the preconditioner has
+ *  degraded: the iteration count of the first solve after a rebuild is taken
+ *  as the reference, and a rebuild is triggered when
+ *
+ *  - the iteration count grows past `iterationGrowth` times the reference,
+ *  - the time spent on iterations in excess of the reference exceeds the
+ *    time of the last full rebuild, or
+ *  - `maxReuseSolves` solves have been made since the last rebuild.
+ *
+ *  Timings are reduced to their maximum over all ranks so that every rank
+ *  takes the same decision.
+ */
+class PreconditionerReusePolicy
+{
+public:
+  enum Action {
+    RECOMPUTE, //!< Build a new preconditioner
+    REUSE,     //!< Refresh numerics, keep the existing structure
+    FROZEN     //!< Apply the existing preconditioner unchanged
+  };
+
+  PreconditionerReusePolicy(
+    bool adaptive,
+    double iterationGrowth,
+    int maxReuseSolves);
+
+  /** Action to take before the next solve
+   *
+   *  @param[in] recompute The static recompute_preconditioner flag
+   *  @param[in] reuse The static reuse_preconditioner flag
+   *  @param[in] hasPreconditioner Whether a preconditioner exists already
+   */
+  Action next_action(bool recompute, bool reuse, bool hasPreconditioner);
+
+  /** Record the outcome of a solve made after next_action
+   *
+   *  @param[in] iters Linear iterations to convergence
+   *  @param[in] setupTime Time spent on the preconditioner for this solve
+   *  @param[in] solveTime Time spent in the Krylov iterations
+   *  @param[in] comm Communicator of the linear system
+   */
+  void record_solve(int iters, double setupTime, double solveTime, MPI_Comm comm);
+
+  bool adaptive() const { return adaptive_; }
+
+  //! Number of full rebuilds made so far
+  int num_rebuilds() const { return numRebuilds_; }
+
+  //! Iteration count of the first solve after the last rebuild
+  int reference_iterations() const { return referenceIters_; }
+
+private:
+  const bool adaptive_;
+  const double iterationGrowth_;
+  const int maxReuseSolves_;
+
+  Action lastAction_{RECOMPUTE};
+  bool rebuildRequested_{false};
+  bool haveReference_{false};
+  int referenceIters_{0};
+  int solvesSinceRebuild_{0};
+  int numRebuilds_{0};
+  double rebuildTime_{0.0};
+  double excessTime_{0.0};
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -24,8 +24,11 @@
 
 #include <stk_util/util/ParameterList.hpp>
 
+#include <mpi.h>
+
 // standard c++
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 #include <stdint.h>
@@ -74,6 +77,10 @@ class TurbulenceAveragingPostProcessing;
 class DataProbePostProcessing;
 class Actuator;
 class ABLForcingAlgorithm;
+class AsyncOutputManager;
+class LoadRebalancer;
+class TimingRegistry;
+class MemoryAccounting;
 
 class TensorProductQuadratureRule;
 class LagrangeBasis;
@@ -107,6 +114,7 @@ class Realm {
   bool debug() const;
   bool get_activate_memory_diagnostic();
   void provide_memory_summary();
+  void provide_memory_accounting();
   std::string convert_bytes(double bytes);
 
   void create_mesh();
@@ -150,7 +158,18 @@ class Realm {
   void delete_edges();
   void commit();
 
+  // staging fields and i/o thread for asynchronous results/restart output
+  void setup_async_output();
+  // completes pending output writes; required before mesh modification
+  void wait_for_async_output();
+  // completes pending output writes of every realm; required before synchronous io
+  void wait_for_all_async_output();
+
   void process_mesh_motion();
+
+  // repartition on measured work and rebuild the mesh-dependent data
+  void rebalance_mesh();
+  int rebalance_count() const;
   void compute_centroid_on_parts(
     std::vector<std::string> partNames,
     std::vector<double> &centroid);
@@ -277,6 +296,16 @@ class Realm {
    *  \sa Realm::hypreGlobalId_
    */
   void set_hypre_global_id();
+
+  /** Determine whether the linear system graphs must be rebuilt after mesh motion
+   *
+   *  Collective; the graph is unchanged when the mesh has not been modified
+   *  and the nonconformal element couplings match those of the last build.
+   */
+  bool linear_system_graph_changed();
+
+  /// record the mesh state the current linear system graphs were built on
+  void mark_linear_system_graph();
  
   /// check job for fitting in memory
   void check_job(bool get_node_count);
@@ -354,6 +383,15 @@ class Realm {
                                               const stk::mesh::Selector & selector ,
                                               bool get_all = false) const;
 
+  // communicator of the ranks that own this realm; MPI_COMM_NULL on all
+  // other ranks when the realm runs on a subset of the processors
+  void set_parallel_communicator(int firstRank, int numRanks);
+  MPI_Comm parallel_comm() const;
+  int parallel_rank() const;
+  int parallel_size() const;
+  bool is_active() const;
+  bool has_split_communicator() const;
+
   // get aura, bulk and meta data
   bool get_activate_aura();
   stk::mesh::BulkData & bulk_data();
@@ -379,6 +417,12 @@ class Realm {
   std::string inputDBName_;
   unsigned spatialDimension_;
 
+  // realm communicator; number_of_processors = 0 uses all ranks
+  MPI_Comm realmComm_;
+  // duplicate of realmComm_ for the io broker when output is asynchronous
+  MPI_Comm ioComm_;
+  int numberOfProcessors_;
+
   bool realmUsesEdges_;
   int solveFrequency_;
   bool isTurbulent_;
@@ -424,12 +468,19 @@ class Realm {
 
   SolutionOptions *solutionOptions_;
   OutputInfo *outputInfo_;
+  TimingRegistry *timingRegistry_;
+  MemoryAccounting *memoryAccounting_;
+  std::unique_ptr<AsyncOutputManager> asyncOutput_;
+  std::vector<const stk::mesh::FieldBase *> asyncResultsFields_;
+  std::vector<const stk::mesh::FieldBase *> asyncRestartFields_;
   PostProcessingInfo *postProcessingInfo_;
   SolutionNormPostProcessing *solutionNormPostProcessing_;
   TurbulenceAveragingPostProcessing *turbulenceAveragingPostProcessing_;
   DataProbePostProcessing *dataProbePostProcessing_;
   Actuator *actuator_;
   ABLForcingAlgorithm *ablForcingAlg_;
+  LoadRebalancer *loadRebalancer_;
+  bool meshRebalanced_;
 
   std::vector<Algorithm *> propertyAlg_;
   std::map<PropertyIdentifier, ScalarFieldType *> propertyMap_;
@@ -452,12 +503,17 @@ class Realm {
   double timerSkinMesh_;
   double timerPromoteMesh_;
   double timerSortExposedFace_;
+  double timerActuator_;
+  double timerRebalance_;
 
   NonConformalManager *nonConformalManager_;
   OversetManager *oversetManager_;
   bool hasNonConformal_;
   bool hasOverset_;
 
+  // mesh synchronized count at the last linear system graph build
+  size_t linearSystemGraphSyncCount_{0};
+
   // three type of transfer operations
   bool hasMultiPhysicsTransfer_;
   bool hasInitializationTransfer_;
@@ -502,6 +558,10 @@ class Realm {
   // allow detailed output (memory) to be provided
   bool activateMemoryDiagnostic_;
 
+  // per-subsystem memory report at initialization and every N steps
+  bool activateMemoryAccounting_;
+  int memoryAccountingFrequency_;
+
   // sometimes restarts can be missing states or dofs
   bool supportInconsistentRestart_;
 
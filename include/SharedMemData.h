@@ -25,7 +25,9 @@ struct SharedMemData {
          const stk::mesh::BulkData& bulk,
          const ElemDataRequests& dataNeededByKernels,
          unsigned nodesPerEntity,
-         unsigned rhsSize)
+         unsigned rhsSize,
+         unsigned algScratchSize = 0,
+         unsigned algIntScratchSize = 0)
      : simdPrereqData(team, bulk, nodesPerEntity, dataNeededByKernels)
     {
         for(int simdIndex=0; simdIndex<simdLen; ++simdIndex) {
@@ -38,8 +40,14 @@ struct SharedMemData {
 
         scratchIds = get_int_shmem_view_1D(team, rhsSize);
         sortPermutation = get_int_shmem_view_1D(team, rhsSize);
+
+        if (algScratchSize > 0)
+          algScratch = get_shmem_view_1D<double>(team, algScratchSize);
+        if (algIntScratchSize > 0)
+          algIntScratch = get_int_shmem_view_1D(team, algIntScratchSize);
     }
 
+    stk::mesh::Entity elements[simdLen];
     const stk::mesh::Entity* elemNodes[simdLen];
     int numSimdElems;
     std::unique_ptr<ScratchViews<double>> prereqData[simdLen];
@@ -51,6 +59,10 @@ struct SharedMemData {
 
     SharedMemView<int*> scratchIds;
     SharedMemView<int*> sortPermutation;
+
+    // per-thread work space owned by the algorithm, e.g. for static condensation
+    SharedMemView<double*> algScratch;
+    SharedMemView<int*> algIntScratch;
 };
 
 struct SharedMemData_FaceElem {
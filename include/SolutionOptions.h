@@ -209,6 +209,16 @@ public:
   //! Flag indicating whether the user has requested pressure referencing
   bool needPressureReference_{false};
 
+  //! Element assembly scatter mode: "automatic", "atomic" or "coloring"
+  std::string elemAssemblyScatter_{"automatic"};
+
+  //! Edge assembly scatter mode: "serial" or "coloring" (threaded edge loop,
+  //! scalar per-edge arithmetic)
+  std::string edgeAssemblyScatter_{"serial"};
+
+  //! Keep the linear systems across mesh motion steps when the graph is unchanged
+  bool reuseLinearSystemGraph_{false};
+
   std::unique_ptr<FixPressureAtNodeInfo> fixPressureInfo_;
 
   std::string name_;
@@ -34,6 +34,12 @@ public:
   virtual void execute() = 0;
   virtual void initialize_connectivity() = 0;
 
+  // register "<equation system>/assemble/<algorithm>" and the nested kernel
+  // and supplemental algorithm timers with the realm's timing registry
+  void register_timers();
+
+  int timerId_;
+
 protected:
 
   // Need to find out whether this ever gets called inside a modification cycle.
@@ -54,7 +60,35 @@ protected:
     const SharedMemView<const double**> & lhs,
     const char *trace_tag);
 
+  // as above, for the nodes of a single element/edge/face; lets the linear
+  // system use its cached assembly plan for meshObj
+  void apply_coeff(
+    stk::mesh::Entity meshObj,
+    const std::vector<stk::mesh::Entity> & sym_meshobj,
+    std::vector<int> &scratchIds,
+    std::vector<double> &scratchVals,
+    const std::vector<double> &rhs,
+    const std::vector<double> &lhs,
+    const char *trace_tag=0);
+
+  void apply_coeff(
+    stk::mesh::Entity meshObj,
+    unsigned numMeshobjs,
+    const stk::mesh::Entity* symMeshobjs,
+    const SharedMemView<int*> & scratchIds,
+    const SharedMemView<int*> & sortPermutation,
+    const SharedMemView<const double*> & rhs,
+    const SharedMemView<const double**> & lhs,
+    const char *trace_tag);
+
   EquationSystem *eqSystem_;
+
+  // timer ids parallel to activeKernels_ and supplementalAlg_
+  std::vector<int> kernelTimerIds_;
+  std::vector<int> suppTimerIds_;
+
+private:
+  bool timersRegistered_;
 };
 
 } // namespace nalu
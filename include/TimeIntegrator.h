@@ -65,6 +65,11 @@ public:
 
   std::vector<Realm*> realmVec_;
 
+  // realms owned by this rank; differs from realmVec_ when realms run
+  // concurrently on disjoint sets of processors
+  std::vector<Realm*> activeRealmVec_;
+  bool concurrentRealms_{false};
+
   double get_time_step(
   const NaluState &theState = NALU_STATE_N) const;
   double get_current_time() const;
@@ -0,0 +1,115 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef TimingRegistry_h
+#define TimingRegistry_h
+
+#include <mpi.h>
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+namespace YAML {
+class Node;
+}
+
+namespace sierra{
+namespace nalu{
+
+/** Hierarchical registry of wall-clock timers for a realm
+ *
+ *  Timers are identified by '/' separated paths such as
+ *  "MomentumEQS/assemble/AssembleElemSolverAlgorithm/MomentumAdvDiffElemKernel<AlgTraitsHex8>"
+ *  and registered on first use; the returned integer id is cached by the
+ *  caller so that the hot path is a plain array update. The registry is
+ *  active only when a `timing_output` block is present in the realm; without
+ *  one, timer_id() returns -1 and Scope is a no-op.
+ *
+ *  Timers may be updated from within Kokkos host loops; the times are then
+ *  summed over threads. Output reduces the min/avg/max over ranks for the
+ *  union of the timers registered on any rank and is written by rank 0,
+ *  per step and as running totals, as CSV or newline-delimited JSON.
+ */
+class TimingRegistry
+{
+public:
+  TimingRegistry();
+
+  //! Read the optional timing_output block of a realm
+  void load(const YAML::Node & node);
+
+  bool active() const { return active_; }
+
+  //! Id of the named timer, registering it if needed; -1 when inactive
+  int timer_id(const std::string &name);
+
+  //! Accumulate one call of the given duration; thread-safe
+  void add_time(int id, double seconds);
+
+  //! Write the per-step record when due and reset the step accumulators
+  void end_step(int timeStepCount, double currentTime, MPI_Comm comm);
+
+  //! Write the accumulated totals
+  void write_totals(int timeStepCount, double currentTime, MPI_Comm comm);
+
+  //! Readable class name of a type, without the sierra::nalu namespace
+  static std::string type_name(const std::type_info &info);
+
+  //! Time the enclosing scope into a timer; a no-op for id -1
+  class Scope
+  {
+  public:
+    Scope(TimingRegistry &registry, int id)
+      : registry_(registry), id_(id)
+    {
+      if ( id_ >= 0 )
+        start_ = std::chrono::steady_clock::now();
+    }
+    ~Scope()
+    {
+      if ( id_ >= 0 )
+        registry_.add_time(id_, std::chrono::duration<double>(
+          std::chrono::steady_clock::now() - start_).count());
+    }
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+  private:
+    TimingRegistry &registry_;
+    const int id_;
+    std::chrono::steady_clock::time_point start_;
+  };
+
+private:
+  void write_record(
+    const char *kind, int timeStepCount, double currentTime,
+    const std::vector<double> &times, const std::vector<double> &calls,
+    MPI_Comm comm);
+
+  std::vector<std::string> global_names(MPI_Comm comm) const;
+
+  bool active_{false};
+  std::string format_{"csv"};
+  std::string fileName_{"timings.csv"};
+  int frequency_{0};
+  bool fileOpened_{false};
+
+  std::map<std::string, int> ids_;
+  std::vector<std::string> names_;
+  std::vector<double> stepTime_;
+  std::vector<double> stepCalls_;
+  std::vector<double> totalTime_;
+  std::vector<double> totalCalls_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -38,6 +38,7 @@ class Realm;
 class EquationSystem;
 class LinearSolver;
 class LocalGraphArrays;
+class MatrixFreeElemOperator;
 
 typedef std::unordered_map<stk::mesh::EntityId, size_t>  MyLIDMapType;
 
@@ -76,6 +77,8 @@ public:
   void buildFaceElemToNodeGraph(const stk::mesh::PartVector & parts); // elem:face->node assembly
   void buildNonConformalNodeGraph(const stk::mesh::PartVector & parts); // nonConformal->node assembly
   void buildOversetNodeGraph(const stk::mesh::PartVector & parts); // overset->elem_node assembly
+  void buildLowOrderElemToNodeGraph(const stk::mesh::PartVector & parts,
+                                    const std::vector<unsigned char> & nodeCoupling); // elem (low-order part)->node assembly
   void storeOwnersForShared();
   void finalizeLinearSystem();
 
@@ -100,6 +103,28 @@ public:
     const char *trace_tag=0
     );
 
+  void sumInto(
+      stk::mesh::Entity meshObj,
+      unsigned numEntities,
+      const stk::mesh::Entity* entities,
+      const SharedMemView<const double*> & rhs,
+      const SharedMemView<const double**> & lhs,
+      const SharedMemView<int*> & localIds,
+      const SharedMemView<int*> & sortPermutation,
+      const char * trace_tag);
+
+  void sumInto(
+    stk::mesh::Entity meshObj,
+    const std::vector<stk::mesh::Entity> & entities,
+    std::vector<int> &scratchIds,
+    std::vector<double> &scratchVals,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0);
+
+  //! Flag indicating whether a cached assembly plan exists for the mesh object
+  bool has_assembly_plan(stk::mesh::Entity meshObj) const;
+
   void applyDirichletBCs(
     stk::mesh::FieldBase * solutionField,
     stk::mesh::FieldBase * bcValuesField,
@@ -111,6 +136,33 @@ public:
     const unsigned beginPos,
     const unsigned endPos);
 
+  // matrix-free element operator
+  bool matrixFreeActive() const { return matrixFreeActive_; }
+
+  void register_matrix_free_algorithm(AssembleElemSolverAlgorithm* alg);
+
+  void applyElemOperator(
+    unsigned numEntities,
+    const stk::mesh::Entity* entities,
+    const SharedMemView<const double**> & lhs);
+
+  /** Compute y = beta*y + alpha*A*x with the element contributions evaluated on the fly
+   *
+   *  \sa sierra::nalu::MatrixFreeElemOperator
+   */
+  void applyMatrixFree(
+    const LinSys::MultiVector & x,
+    LinSys::MultiVector & y,
+    const double alpha,
+    const double beta);
+
+  // static condensation of promoted element interiors
+  bool staticCondensationActive() const { return staticCondensationActive_; }
+
+  void buildCondensedElemToNodeGraph(const stk::mesh::PartVector & parts);
+
+  void register_condensed_algorithm(AssembleElemSolverAlgorithm* alg);
+
   /** Reset LHS and RHS for the given set of nodes to 0
    *
    *  @param nodeList A list of STK node entities whose rows are zeroed out
@@ -128,6 +180,7 @@ public:
   void writeToFile(const char * filename, bool useOwned=true);
   void printInfo(bool useOwned=true);
   void writeSolutionToFile(const char * filename, bool useOwned=true);
+  void report_memory(MemoryAccounting & acct, const std::string & prefix);
   size_t lookup_myLID(MyLIDMapType& myLIDs, stk::mesh::EntityId entityId, const char* msg=nullptr, stk::mesh::Entity entity = stk::mesh::Entity())
   {
     return myLIDs[entityId];
@@ -138,6 +191,12 @@ public:
 
   Teuchos::RCP<LinSys::Graph>  getOwnedGraph() { return ownedGraph_; }
   Teuchos::RCP<LinSys::Matrix> getOwnedMatrix() { return ownedMatrix_; }
+  Teuchos::RCP<LinSys::Vector> getOwnedRhs() { return ownedRhs_; }
+  Teuchos::RCP<LinSys::MultiVector> getCoordinates() { return coords_; }
+
+  // copy the current nodal coordinates into those handed to MueLu; a graph
+  // kept across mesh motion would otherwise aggregate on the old positions
+  void refreshSolverCoordinates();
 
 private:
   void buildConnectedNodeGraph(stk::mesh::EntityRank rank,
@@ -145,6 +204,13 @@ private:
 
   void beginLinearSystemConstruction();
 
+  void mark_condensed_nodes();
+
+  bool is_condensed_node(stk::mesh::Entity node) const
+  {
+    return node.local_offset() < condensedNode_.size() && condensedNode_[node.local_offset()];
+  }
+
   void checkError( const int err_code, const char * msg) {}
 
   void compute_send_lengths(const std::vector<stk::mesh::Entity>& rowEntities,
@@ -181,6 +247,16 @@ private:
   void checkForNaN(bool useOwned);
   bool checkForZeroRow(bool useOwned, bool doThrow, bool doPrint=false);
 
+  void register_assembly_plan_parts(stk::mesh::EntityRank rank, const stk::mesh::PartVector & parts);
+  void build_assembly_plans();
+  void sum_into_with_plan(
+    const LocalOrdinal* planOffsets,
+    unsigned numEntities,
+    const stk::mesh::Entity* entities,
+    const double* rhs,
+    const double* lhs,
+    const bool useAtomic);
+
   std::vector<stk::mesh::Entity> ownedAndSharedNodes_;
   std::vector<std::vector<stk::mesh::Entity> > connections_;
   std::vector<GlobalOrdinal> totalGids_;
@@ -212,6 +288,7 @@ private:
   Teuchos::RCP<LinSys::Vector> sharedNotOwnedRhs_;
 
   Teuchos::RCP<LinSys::Vector> sln_;
+  Teuchos::RCP<LinSys::MultiVector> coords_;
   Teuchos::RCP<LinSys::Vector> globalSln_;
   Teuchos::RCP<LinSys::Export> exporter_;
 
@@ -222,6 +299,37 @@ private:
   LocalOrdinal maxSharedNotOwnedRowId_; // = (num_owned_nodes + num_sharedNotOwned_nodes) * numDof_
 
   std::vector<int> sortPermutation_;
+
+  // matrix-free element operator; input gathered to the column map, output on owned/sharedNotOwned rows
+  bool matrixFreeActive_;
+  std::vector<AssembleElemSolverAlgorithm*> matrixFreeAlgs_;
+  Teuchos::RCP<MatrixFreeElemOperator> matrixFreeOperator_;
+  Teuchos::RCP<LinSys::Import> mfImporter_;
+  Teuchos::RCP<LinSys::Vector> mfColX_;
+  Teuchos::RCP<LinSys::Vector> mfOwnedY_;
+  Teuchos::RCP<LinSys::Vector> mfSharedNotOwnedY_;
+  host_view_type mfLocalColX_;
+  host_view_type mfLocalOwnedY_;
+  host_view_type mfLocalSharedNotOwnedY_;
+
+  // rows whose assembled values are replaced by constraints; like the assembled
+  // rows, their local element coupling is dropped before the owned/shared export
+  std::vector<LocalOrdinal> mfMaskedRows_;
+  std::vector<LocalOrdinal> mfMaskedSharedNotOwnedRows_;
+
+  // cached assembly plan: for each registered element/edge, the offset of every
+  // (row,col) entry of its local matrix within the CRS row (-1 if absent);
+  // valid until the linear system is reinitialized
+  bool assemblyPlanActive_;
+  std::vector<std::pair<stk::mesh::EntityRank, stk::mesh::PartVector> > assemblyPlanParts_;
+  std::vector<size_t> assemblyPlanBegin_; // indexed by entity local_offset
+  std::vector<LocalOrdinal> assemblyPlanOffsets_;
+
+  // static condensation: the interior nodes of promoted elements own no rows or
+  // columns; registered algorithms recover them after the skeleton solve
+  bool staticCondensationActive_;
+  std::vector<unsigned char> condensedNode_; // indexed by entity local_offset
+  std::vector<AssembleElemSolverAlgorithm*> condensedAlgs_;
 };
 
 template<typename T1, typename T2>
@@ -20,6 +20,7 @@
 namespace stk {
   namespace mesh {
     class BulkData;
+    class Bucket;
     class FieldBase;
     class MetaData;
     class Part;
@@ -91,65 +92,18 @@ public:
   // populate nodal field and output norms (if appropriate)
   void execute();
 
-  // compute tke and stress for each type of operation
-  void compute_tke(
-    const bool isReynolds,
-    const std::string &averageBlockName,
-    stk::mesh::Selector s_all_nodes);
-
-  void compute_reynolds_stress(
-    const std::string &averageBlockName,
-    const double &oldTimeFilter,
-    const double &zeroCurrent,
-    const double &dt,
-    stk::mesh::Selector s_all_nodes);
-
-  void compute_favre_stress(
-    const std::string &averageBlockName,
-    const double &oldTimeFilter,
-    const double &zeroCurrent,
-    const double &dt,
-    stk::mesh::Selector s_all_nodes);
-
-  void compute_resolved_stress(
-      const std::string &averageBlockName,
-      const double &oldTimeFilter,
-      const double &zeroCurrent,
-      const double &dt,
-      stk::mesh::Selector s_all_nodes);
-
-  void compute_sfs_stress(
-      const std::string &averageBlockName,
-      const double &oldTimeFilter,
-      const double &zeroCurrent,
-      const double &dt,
-      stk::mesh::Selector s_all_nodes);
-
-  void compute_temperature_resolved_flux(
-    const std::string &averageBlockName,
-    const double &oldTimeFilter,
-    const double &zeroCurrent,
-    const double &dt,
-    stk::mesh::Selector s_all_nodes);
-
-  void compute_temperature_sfs_flux(
-    const std::string &averageBlockName,
-    const double &oldTimeFilter,
-    const double &zeroCurrent,
-    const double &dt,
-    stk::mesh::Selector s_all_nodes);
-
-  void compute_vorticity(
-    const std::string &averageBlockName,
-	stk::mesh::Selector s_all_nodes);
+  // look up the fields and constants used by the statistics kernel
+  void resolve_fields(
+    AveragingInfo *avInfo);
 
-  void compute_q_criterion(
-	const std::string &averageBlockName,
-	stk::mesh::Selector s_all_nodes);
-
-  void compute_lambda_ci(
-	const std::string &averageBlockName,
-	stk::mesh::Selector s_all_nodes);
+  // fused kernel: update the averages and all requested statistics on one bucket
+  void compute_bucket_statistics(
+    const AveragingInfo *avInfo,
+    stk::mesh::Bucket &b,
+    const double oldTimeFilter,
+    const double zeroCurrent,
+    const double dt,
+    const bool computeStresses);
 
   void compute_mean_resolved_ke(
 	const std::string &averageBlockName,
@@ -168,6 +122,9 @@ public:
 
   // vector of averaging information
   std::vector<AveragingInfo *> averageInfoVec_;
+
+  // bucket-sized scratch holding the previous Reynolds averaged density
+  std::vector<double> oldDensityRA_;
 };
 
 } // namespace nalu
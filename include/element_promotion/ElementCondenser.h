@@ -13,6 +13,8 @@
 #include <Teuchos_SerialDenseMatrix.hpp>
 #include <Teuchos_SerialDenseSolver.hpp>
 
+#include <vector>
+
 
 namespace sierra {
 namespace nalu {
@@ -24,6 +26,17 @@ namespace nalu {
   public:
     ElementCondenser(const ElementDescription& elem);
 
+    // works in caller-owned memory of workspace_size() doubles and
+    // num_internal_nodes() pivots, e.g. per-thread team scratch
+    ElementCondenser(const ElementDescription& elem, double* workspace, int* pivots);
+
+    ElementCondenser(const ElementCondenser&) = delete;
+    void operator=(const ElementCondenser&) = delete;
+
+    static int workspace_size(const ElementDescription& elem);
+
+    // condenses the row-major element system onto the boundary nodes; the
+    // reduced lhs (num_boundary_nodes()^2) is returned column-major
     void condense(
       double* lhs,
       const double* rhs,
@@ -31,34 +44,39 @@ namespace nalu {
       double* r_rhs
     );
 
+    // recovers the interior values from the interior rows [L_IB L_II] (row-major,
+    // num_internal_nodes() x nodes_per_element()) and interior rhs of the element
+    // system, given the solved boundary values: x_I = L_II^-1 (f_I - L_IB x_B)
     void compute_interior_update(
-      double* lhs,
+      const double* interior_lhs,
+      const double* interior_rhs,
       const double* boundary_values,
-      const double* rhs,
       double* interior_values
     );
 
-    int num_boundary_nodes() { return nb_; }
-    int num_internal_nodes() { return ni_; }
-    int nodes_per_element()  { return ne_; }
+    int num_boundary_nodes() const { return nb_; }
+    int num_internal_nodes() const { return ni_; }
+    int nodes_per_element()  const { return ne_; }
 
   private:
-    void chunk(const double* lhs, const double* rhs, double* b_lhs, double* b_rhs);
-    void chunk_lower(const double* lhs, const double* rhs);
-
     Teuchos::BLAS<int,double> blas_;
     Teuchos::LAPACK<int,double> lapack_;
 
-    std::vector<double> lhsBB_;
-    std::vector<double> lhsIB_;
-    std::vector<double> lhsBI_;
-    std::vector<double> lhsII_;
-    std::vector<double> rhsI_;
-    std::vector<int> ipiv_;
+    void set_workspace(double* workspace, int* pivots);
+
     int nb_;
     int ni_;
     int ne_;
 
+    std::vector<double> workspace_;
+    std::vector<int> pivots_;
+
+    double* lhsIB_;
+    double* lhsBI_;
+    double* lhsII_;
+    double* rhsI_;
+    int* ipiv_;
+
   };
 
 } // namespace nalu
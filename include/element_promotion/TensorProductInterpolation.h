@@ -0,0 +1,79 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level nalu      */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+#ifndef TensorProductInterpolation_h
+#define TensorProductInterpolation_h
+
+#include <array>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+  struct ElementDescription;
+
+  class TensorProductInterpolation
+  {
+    /**
+     * Sum-factorized evaluation of hex element data on a tensor-product grid of
+     * points, points1D[0] x points1D[1] x points1D[2] with the first direction
+     * varying fastest.
+     *
+     * The element nodes are reordered into their tensor-product layout and the
+     * 1D interpolation/derivative operators are applied one direction at a time,
+     * so evaluating a nodal quantity at all O(p^3) points costs O(p^4) rather
+     * than the O(p^6) of the dense (numPoints x nodesPerElement) shape function
+     * matrices.
+     */
+  public:
+    TensorProductInterpolation(
+      const ElementDescription& elem,
+      const std::array<std::vector<double>, 3>& points1D);
+
+    int num_points() const { return numPoints_; }
+    int num_points(int direction) const { return numPoints1D_[direction]; }
+
+    int grid_index(int i, int j, int k) const
+    { return i + numPoints1D_[0] * (j + numPoints1D_[1] * k); }
+
+    // length of the caller-provided scratch of interpolate and jacobian
+    int scratch_size() const { return scratchSize_; }
+
+    // values of a scalar nodal field (element node ordering) at the grid points
+    void interpolate(const double* nodalValues, double* gridValues, double* scratch) const;
+
+    // isoparametric jacobian dx_i/ds_j of the element at the grid points;
+    // 9 values per point, row-major (i slowest)
+    void jacobian(const double* elemNodalCoords, double* gridJacobian, double* scratch) const;
+
+  private:
+    void contract(
+      const double* op0,
+      const double* op1,
+      const double* op2,
+      const double* tensorValues,
+      double* gridValues,
+      double* work) const;
+
+    int nodes1D_;
+    int nodesPerElement_;
+    int numPoints_;
+    std::array<int, 3> numPoints1D_;
+    int workSize_;
+    int scratchSize_;
+
+    // tensor-product ordinal -> element node ordinal
+    std::vector<int> tensorNodeMap_;
+
+    // 1D operators per direction, (numPoints1D x nodes1D) row-major
+    std::array<std::vector<double>, 3> interpOp_;
+    std::array<std::vector<double>, 3> derivOp_;
+  };
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -0,0 +1,90 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef MasterElementBatch_h
+#define MasterElementBatch_h
+
+#include <FieldTypeDef.h>
+#include <SimdInterface.h>
+
+#include <map>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class Bucket;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class MasterElement;
+
+//==========================================================================
+// Class Definition
+//==========================================================================
+// MasterElementBatch - scv volumes and scs/face area vectors for all of the
+//                      entities of a bucket; when the master element has a
+//                      SharedMemView determinant, simdLen entities are
+//                      interleaved per call, otherwise the legacy
+//                      determinant runs over the gathered coordinates.
+//                      Scratch is kept across buckets and calls.
+//==========================================================================
+class MasterElementBatch
+{
+public:
+  explicit MasterElementBatch(int nDim);
+  ~MasterElementBatch();
+
+  // [entity][ip], valid until the next call
+  const double *scv_volume(
+    MasterElement &meSCV,
+    const stk::mesh::Bucket &b,
+    const VectorFieldType &coordinates);
+
+  // [entity][ip][nDim], valid until the next call
+  const double *scs_areav(
+    MasterElement &meSCS,
+    const stk::mesh::Bucket &b,
+    const VectorFieldType &coordinates);
+
+private:
+  void gather_coordinates(
+    const int nodesPerElement,
+    const stk::mesh::Bucket &b,
+    const VectorFieldType &coordinates);
+
+  void interleave_coordinates(
+    const int nodesPerElement,
+    const size_t firstEntity,
+    const int numLanes);
+
+  bool use_simd(
+    std::map<const MasterElement *, bool> &hasSimd,
+    const MasterElement &me);
+
+  const int nDim_;
+
+  // legacy layout [entity][node][nDim] and results
+  std::vector<double> coords_;
+  std::vector<double> values_;
+
+  // interleaved coordinates and results for one simd group
+  ScalarAlignedVector simdCoords_;
+  ScalarAlignedVector simdValues_;
+
+  // master elements without a SharedMemView determinant fall back once
+  std::map<const MasterElement *, bool> hasSimdScv_;
+  std::map<const MasterElement *, bool> hasSimdScs_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
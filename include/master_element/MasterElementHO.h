@@ -10,6 +10,7 @@
 #include <master_element/MasterElement.h>
 #include <element_promotion/TensorProductQuadratureRule.h>
 #include <element_promotion/LagrangeBasis.h>
+#include <element_promotion/TensorProductInterpolation.h>
 
 #include <element_promotion/ElementDescription.h>
 #include <element_promotion/HexNElementDescription.h>
@@ -75,9 +76,9 @@ public:
 private:
   void set_interior_info();
 
-  double jacobian_determinant(
-    const double* POINTER_RESTRICT elemNodalCoords,
-    const double* POINTER_RESTRICT shapeDerivs ) const;
+  // sum-factorized isoparametric jacobian at every ip, 9 values per ip;
+  // scratch holds the grid jacobians and the grid's contraction work
+  void ip_jacobians(const double* elemNodalCoords, double* jac, double* scratch) const;
 
   const ElementDescription elem_;
   LagrangeBasis basis_;
@@ -86,6 +87,13 @@ private:
   std::vector<double> shapeFunctionVals_;
   std::vector<double> shapeDerivs_;
   std::vector<double> ipWeights_;
+
+  // the scv ips form a tensor-product grid; ip ordinal -> grid point
+  const TensorProductInterpolation ipGrid_;
+  std::vector<int> ipToGrid_;
+
+  // per-call scratch length of determinant and grad_op
+  int scratchSize_;
 };
 
 // 3D Hex 27 subcontrol surface
@@ -166,10 +174,13 @@ private:
 
   template <Jacobian::Direction direction> void
   area_vector(
-    const double *POINTER_RESTRICT elemNodalCoords,
-    double *POINTER_RESTRICT shapeDeriv,
+    const double *POINTER_RESTRICT jac,
     double *POINTER_RESTRICT areaVector) const;
 
+  // sum-factorized isoparametric jacobian at every ip, 9 values per ip;
+  // scratch holds the grid jacobians and the grid's contraction work
+  void ip_jacobians(const double* elemNodalCoords, double* jac, double* scratch) const;
+
   const ElementDescription elem_;
   LagrangeBasis basis_;
   const TensorProductQuadratureRule quadrature_;
@@ -179,6 +190,14 @@ private:
   std::vector<double> expFaceShapeDerivs_;
   std::vector<ContourData> ipInfo_;
   int ipsPerFace_;
+
+  // the ips of each family of constant u, t and s surfaces form a
+  // tensor-product grid; ip ordinal -> grid point within its family
+  std::vector<TensorProductInterpolation> surfaceGrids_;
+  std::vector<int> ipToGrid_;
+
+  // per-call scratch length of determinant and grad_op
+  int scratchSize_;
 };
 
 // 3D Quad 9
@@ -38,7 +38,6 @@ public:
 
   const RadiativeTransportEquationSystem *radEqSystem_;
 
-  ScalarFieldType *intensity_;
   VectorFieldType *edgeAreaVec_;
   VectorFieldType *coordinates_;
   ScalarFieldType *absorption_;
@@ -40,7 +40,6 @@ public:
   const RadiativeTransportEquationSystem *radEqSystem_;
   const bool useShifted_;
 
-  ScalarFieldType *intensity_;
   ScalarFieldType *bcIntensity_;
   GenericFieldType *exposedAreaVec_;
 };
@@ -14,6 +14,8 @@
 
 #include <stk_mesh/base/Entity.hpp>
 
+#include <vector>
+
 namespace sierra{
 namespace nalu{
 
@@ -38,7 +40,7 @@ public:
       stk::mesh::Entity node);
  
   const RadiativeTransportEquationSystem *radEqSystem_;
-  ScalarFieldType *intensity_;
+  std::vector<ScalarFieldType *> intensity_;
   ScalarFieldType *absorption_;
   ScalarFieldType *scattering_;
   ScalarFieldType *radiationSource_;
@@ -36,7 +36,8 @@ public:
       const bool activateScattering,
       const bool activateUpwind,
       const bool deactivateSucv,
-      const bool externalCoupling);
+      const bool externalCoupling,
+      const int ordinateBlockSize = 1);
   virtual ~RadiativeTransportEquationSystem();
   
   void register_nodal_fields(
@@ -66,6 +67,13 @@ public:
   void set_current_ordinate_info(
       const int k);
 
+  // ordinates [k, k+ordinateBlockSize_) are assembled into one block system
+  void set_current_ordinate_block(
+      const int k);
+
+  void update_block_intensity(
+      const int j);
+
   void initialize_intensity();
   void compute_bc_intensity();
   void compute_radiation_source();
@@ -96,6 +104,22 @@ public:
   void get_current_ordinate(
       double *Sk) const;
 
+  // number of ordinates, and dofs per node, of the current linear system
+  int ordinate_block_size() const { return ordinateBlockSize_; }
+
+  // the block system stores dense node blocks although only their diagonal
+  // couples; larger blocks would spend more memory than they save in solves
+  static const int MAX_ORDINATE_BLOCK_SIZE = 8;
+
+  // direction and intensity of the j'th ordinate in the current block
+  void get_block_ordinate(
+      const int j,
+      double *Sk) const;
+
+  ScalarFieldType *
+  get_block_intensity(
+      const int j) const;
+
   double get_stefan_boltzmann() const;
   
   ScalarFieldType *
@@ -108,6 +132,7 @@ public:
   const bool activateUpwind_;
   const bool deactivateSucv_;
   const bool externalCoupling_;
+  const int ordinateBlockSize_;
   
   ScalarFieldType *intensity_;
   ScalarFieldType *currentIntensity_;
@@ -116,6 +141,7 @@ public:
   ScalarFieldType *transmissivity_;
   ScalarFieldType *environmentalT_;
   ScalarFieldType *iTmp_;
+  GenericFieldType *iTmpBlock_;
   ScalarFieldType *dualNodalVolume_;
   VectorFieldType *coordinates_;
   ScalarFieldType *temperature_;
@@ -139,8 +165,13 @@ public:
   std::vector<double> Sn_;
   std::vector<double> weights_;
 
+  // intensity for each ordinate direction
+  std::vector<ScalarFieldType *> ordinateIntensity_;
+
   // current set
   std::vector<double> currentSn_;
+  std::vector<double> blockSn_;
+  std::vector<ScalarFieldType *> blockIntensity_;
   double currentWeight_;
   double stefanBoltz_;
   double systemL2Norm_;
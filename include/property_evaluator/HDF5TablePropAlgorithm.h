@@ -63,8 +63,8 @@ public:
   const size_t indVarSize_;
 
   std::vector<stk::mesh::FieldBase *> indVar_;
-  std::vector<double *> workIndVar_;
-  std::vector<double> workZ_;
+  std::vector<const double *> workIndVar_;
+  HDF5TableWorkspace tableWorkspace_;
 
   /** execute Algorithm */
   virtual void execute();
@@ -1,6 +1,7 @@
 #ifndef BSPLINE_H
 #define BSPLINE_H
 
+#include <cstddef>
 #include <vector>
 
 namespace sierra {
@@ -8,6 +9,27 @@ namespace nalu {
 
 // Forward declarations
 class H5IO;
+class BSpline1D;
+
+//====================================================================
+//====================================================================
+
+/**
+ *  @class  BSplineWorkspace
+ *  @brief  Scratch space for batched spline evaluation
+ *
+ *  The batched BSpline::values() method writes only to this object, so
+ *  one workspace per thread allows concurrent evaluation of a shared
+ *  spline.  Buffers grow to the largest batch seen and are then reused.
+ */
+class BSplineWorkspace{
+ public:
+  std::vector<double> uk_;     // parametric coordinate, per point
+  std::vector<int>    shift_;  // first active control point, per dimension and point
+  std::vector<double> basis_;  // basis functions, [dim][j][point]
+  std::vector<double> left_;   // basis recurrence scratch, [j][point]
+  std::vector<double> right_;  // basis recurrence scratch, [j][point]
+};
 
 //====================================================================
 //====================================================================
@@ -26,6 +48,9 @@ class H5IO;
 class BSpline{
  public:
 
+  /** Highest supported order; value() evaluates the basis on the stack */
+  static const int MAX_ORDER = 10;
+
   BSpline( const int order,
 	   const int dimension,
 	   const bool enableValueClipping=true );
@@ -55,6 +80,36 @@ class BSpline{
 
   double value( std::vector<double> & x ) const{ return value( &x[0] ); }
 
+  /**
+   *  Evaluate the spline at a batch of points.  x[d] points to the npts
+   *  values of the d-th independent variable and result receives npts
+   *  values.  Knot search and basis evaluation are done across the batch;
+   *  setup_batched_evaluation() must have been called, otherwise each
+   *  point is evaluated with value().
+   */
+  void values( const int npts,
+               const double* const* x,
+               double* result,
+               BSplineWorkspace & ws ) const;
+
+  /**
+   *  Flatten the nested splines into one tensor-product control point array
+   *  for values().  This is skipped (values() falls back to point-wise
+   *  evaluation) if the sub-splines of a dimension do not share a basis.
+   */
+  void setup_batched_evaluation();
+
+  /**
+   *  Append the 1-D spline defining each dimension to dims and this
+   *  spline's control points, last dimension fastest, to ctrlPts.
+   *  Returns false if the sub-splines of a dimension differ in basis.
+   */
+  virtual bool flatten( std::vector<const BSpline1D*> & dims,
+                        std::vector<double> & ctrlPts ) const = 0;
+
+  /** Query whether the independent variables are clipped to the spline bounds */
+  bool clips_values() const{ return enableValueClipping_; }
+
   /**
    *  Read a spline from an HDF5 database.  The file should be opened
    *  and an hdf5 "group" specified.  This spline will be read from the
@@ -77,6 +132,19 @@ class BSpline{
 
  private:
 
+  // nested sum over the tensor-product basis for one point of a batch
+  double tensor_contract( const int dim,
+                          const std::size_t offset,
+                          const int pt,
+                          const int npts,
+                          const BSplineWorkspace & ws ) const;
+
+  // per-dimension 1-D splines and flattened control points for values()
+  std::vector<const BSpline1D*> tensorDims_;
+  std::vector<double> tensorCtrlPts_;
+  std::vector<std::size_t> tensorStrides_;
+  int tensorMaxOrder_;
+
   BSpline( const BSpline & );             // no copying
   BSpline & operator=( const BSpline & ); // no assignment
 
@@ -132,6 +200,35 @@ class BSpline1D : public BSpline{
   double value( const double* indepVar ) const;
   inline double value( const double & x ) const{ return value(&x); }
 
+  /**
+   *  Evaluate the order+1 non-zero basis functions at x into N and
+   *  return the index of the first control point they multiply.
+   */
+  int basis( const double x, double* N ) const;
+
+  /**
+   *  Batched form of basis(): N is laid out [j][point] with stride npts.
+   *  Loops run across points so that they vectorize.
+   */
+  void basis( const int npts,
+              const double* x,
+              int* shift,
+              double* N,
+              BSplineWorkspace & ws ) const;
+
+  /** Query whether two splines have identical knots, bounds and order */
+  bool same_basis( const BSpline1D & a ) const{
+    return ( a.order_ == order_ &&
+             a.npts_ == npts_ &&
+             a.maxIndepVarVal_ == maxIndepVarVal_ &&
+             a.minIndepVarVal_ == minIndepVarVal_ &&
+             a.enableValueClipping_ == enableValueClipping_ &&
+             a.knots_ == knots_ );
+  }
+
+  bool flatten( std::vector<const BSpline1D*> & dims,
+                std::vector<double> & ctrlPts ) const;
+
   inline const std::vector<double> & get_control_pts() const{ return controlPts_; }
   inline       std::vector<double> & get_control_pts()      { return controlPts_; }
   inline const std::vector<double> & get_knot_vector() const{ return knots_; };
@@ -178,7 +275,7 @@ class BSpline1D : public BSpline{
   int npts_;
   double maxIndepVarVal_, minIndepVarVal_;
   std::vector<double> knots_, controlPts_;
-  mutable std::vector<double> basisFun_;
+  std::vector<double> basisFun_;
 
   BSpline1D& operator=(const BSpline1D&); // no assignment
 };
@@ -236,6 +333,9 @@ class BSpline2D : public BSpline{
   void write_hdf5( H5IO & io ) const;
   void  read_hdf5( H5IO & io );
 
+  bool flatten( std::vector<const BSpline1D*> & dims,
+                std::vector<double> & ctrlPts ) const;
+
   inline bool operator == (const BSpline2D& a) const{
     bool isEqual = true;
     std::vector<const BSpline1D*>::const_iterator isp  =   dim2Splines_.begin();
@@ -320,6 +420,9 @@ class BSpline3D : public BSpline{
   void write_hdf5( H5IO & io ) const;
   void  read_hdf5( H5IO & io );
 
+  bool flatten( std::vector<const BSpline1D*> & dims,
+                std::vector<double> & ctrlPts ) const;
+
   inline bool operator == (const BSpline3D& a) const{
     bool isEqual = true;
     std::vector<const BSpline2D*>::const_iterator isp  = sp2d_.begin();
@@ -408,6 +511,9 @@ class BSpline4D : public BSpline{
   void write_hdf5( H5IO & io ) const;
   void  read_hdf5( H5IO & io );
 
+  bool flatten( std::vector<const BSpline1D*> & dims,
+                std::vector<double> & ctrlPts ) const;
+
   inline bool operator == (const BSpline4D& a) const{
     bool isEqual = true;
     std::vector<const BSpline3D*>::const_iterator isp  = sp3d_.begin();
@@ -499,6 +605,9 @@ class BSpline5D : public BSpline{
   void write_hdf5( H5IO & io ) const;
   void  read_hdf5( H5IO & io );
 
+  bool flatten( std::vector<const BSpline1D*> & dims,
+                std::vector<double> & ctrlPts ) const;
+
   inline bool operator == (const BSpline5D& a) const{
     bool isEqual = true;
     std::vector<const BSpline4D*>::const_iterator isp  = sp4d_.begin();
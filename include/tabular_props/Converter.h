@@ -64,7 +64,10 @@ class Converter {
    *  @param inputs : Array of independent variable values
    *  @result : The resulting computed value
    */
-  virtual double query( const std::vector<double> &inputs ) const = 0;
+  virtual double query( const double * inputs ) const = 0;
+  double query( const std::vector<double> &inputs ) const {
+    return query( &inputs[0] );
+  }
 
   /** Print a summary of this Converter configuration */
   void print_summary() const;
@@ -110,7 +113,8 @@ class NameConverter : public Converter {
   NameConverter( const std::string & outputName,
                  const std::string & inputName );
 
-  virtual double query( const std::vector<double>  &inputs ) const;
+  using Converter::query;
+  virtual double query( const double * inputs ) const;
 
  private:
   NameConverter operator=( const NameConverter & );  // No assignment
@@ -148,7 +152,8 @@ class ChiConverter : public Converter {
    *  @param inputs : Array of input variable values
    *  @result : The state variable value interpolated from the table
    */
-  virtual double query( const std::vector<double>  &inputs ) const;
+  using Converter::query;
+  virtual double query( const double * inputs ) const;
 
   /** Read this Converter from the provided I/O device */
   virtual void read_hdf5( H5IO & io );
@@ -189,7 +194,8 @@ class DeltaChiConverter : public Converter {
    *  @param inputs : Array of input variable values
    *  @result : The state variable value interpolated from the table
    */
-  virtual double query( const std::vector<double>  &inputs ) const;
+  using Converter::query;
+  virtual double query( const double * inputs ) const;
 
   /** Read this Converter from the provided I/O device */
   virtual void read_hdf5( H5IO & io );
@@ -231,7 +237,8 @@ class GammaConverter : public Converter {
    *  @param inputs : Array of input variable values
    *  @result : The state variable value interpolated from the table
    */
-  virtual double query( const std::vector<double>  &inputs ) const;
+  using Converter::query;
+  virtual double query( const double * inputs ) const;
 
   /** Read this Converter from the provided I/O device */
   virtual void read_hdf5( H5IO & io );
@@ -273,7 +280,8 @@ class DeltaGammaConverter : public Converter {
    *  @param inputs : Array of input variable values
    *  @result : The state variable value interpolated from the table
    */
-  virtual double query( const std::vector<double>  &inputs ) const;
+  using Converter::query;
+  virtual double query( const double * inputs ) const;
 
   /** Read this Converter from the provided I/O device */
   virtual void read_hdf5( H5IO & io );
@@ -284,7 +292,6 @@ class DeltaGammaConverter : public Converter {
   unsigned int numMixFrac_;
   std::vector<std::vector<double> > zStoich_;
   std::vector<double> gammaMaxStoich_;
-  mutable std::vector<double> zMean_;
 };
 
 //============================================================================
@@ -304,6 +311,9 @@ class HStarConverter : public Converter {
 
   explicit HStarConverter( const bool isDelta = false );
 
+  /** Most mixture fractions supported; query() keeps its scratch on the stack */
+  static const unsigned int MAX_MIX_FRAC = 8;
+
   /* This version is used in Atab_ConverterBuilder.C */
   /*
   HStarConverter( const std::string & outputName,
@@ -323,7 +333,8 @@ class HStarConverter : public Converter {
    *  @param inputs : Array of input variable values
    *  @result : The state variable value interpolated from the table
    */
-  virtual double query( const std::vector<double>  &inputs ) const;
+  using Converter::query;
+  virtual double query( const double * inputs ) const;
 
   /** Read this Converter from the provided I/O device */
   virtual void read_hdf5( H5IO & io );
@@ -331,14 +342,13 @@ class HStarConverter : public Converter {
  private:
   HStarConverter operator=( const HStarConverter & );  // No assignment
 
-  void augmented_mixfrac( const std::vector<double> &mixFrac,
-                          std::vector<double> & mixFracAug ) const;
+  void augmented_mixfrac( const double * mixFrac,
+                          double * mixFracAug ) const;
 
-  double mixture_property( const std::vector<double> & mixFracAug,
+  double mixture_property( const double * mixFracAug,
                            const std::vector<double> & streamProp ) const;
 
   unsigned int numMixFrac_;
-  mutable std::vector<double> zAug_;  // Augmented mixture fraction buffer space
 
   double hStar_ref_min_;
   std::vector<double> hStar_stream_min_;
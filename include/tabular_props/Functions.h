@@ -68,8 +68,13 @@ class FChi {
 double F_gamma( const double Z, const double Z_st );
 
 double F_gamma( const std::vector<double> & Z,
-                std::vector<std::vector<double> > Z_st, // local copy
-                std::vector<double> gamma_mas_st );     // local copy
+                const std::vector<std::vector<double> > & Z_st,
+                const std::vector<double> & gamma_max_st );
+
+double F_gamma( const double * Z,
+                const unsigned int numMixFrac,
+                const std::vector<std::vector<double> > & Z_st,
+                const std::vector<double> & gamma_max_st );
 
 //============================================================================
 /** Class to wrap the F_gamma() function with an interface that is
@@ -77,7 +82,7 @@ double F_gamma( const std::vector<double> & Z,
  */
 class FGamma {
  public:
-  explicit FGamma( const int nMixFrac ) { zBuf_.resize( nMixFrac, 0.0 ); }
+  explicit FGamma( const int nMixFrac ) : numMixFrac_( nMixFrac ) {}
   ~FGamma(){};
 
   void setZStoich( const std::vector<std::vector<double> > & zStoich )
@@ -87,7 +92,7 @@ class FGamma {
   double query( const double * Z ) const;
 
  private:
-  mutable std::vector<double> zBuf_;
+  unsigned int numMixFrac_;
   std::vector<std::vector<double> > zStoich_;
   std::vector<double> gammaMaxStoich_;
 };
@@ -5,8 +5,10 @@
 #include <set>
 #include <string>
 #include <map>
+#include <mutex>
 
 #include "tabular_props/H5IO.h"
+#include "tabular_props/BSpline.h"
 
 namespace sierra {
 namespace nalu {
@@ -34,6 +36,23 @@ class ClipEventSortCriterion {
 
 typedef std::set<ClipEvent, ClipEventSortCriterion<ClipEvent> > ClipEventLog;
 
+/**
+ *  @class  HDF5TableWorkspace
+ *  @brief  Scratch space for the batched HDF5Table::query()
+ *
+ *  Each thread evaluating a shared table needs its own workspace.
+ */
+class HDF5TableWorkspace
+{
+ public:
+  std::vector<double> lookup_;              // table inputs, [dim][point]
+  std::vector<double> checked_;             // clipped/log-scaled inputs, [dim][point]
+  std::vector<const double *> checkedPtrs_; // start of each dimension in checked_
+  std::vector<char> clipped_;               // clipping status, per point
+  std::vector<double> pointBuf_;            // single point gather for converters and logging
+  BSplineWorkspace splineWs_;
+};
+
 /**
  *  @class  HDF5Table
  *  @brief  Object to manage property evaluation as a function of a set of
@@ -52,6 +71,10 @@ class HDF5Table
  public:
   
   typedef std::map<std::string, std::string> Attributes;
+
+  /** Most input variables supported; the scalar query() keeps its
+   *  scratch on the stack */
+  static const unsigned int MAX_INPUTS = 16;
   
   /** Construct an empty HDF5Table 
    *  This can be filled later with read_hdf5( H5IO fileIO ).
@@ -94,6 +117,17 @@ class HDF5Table
    *  @result : The property as a function of the inputs
    */
   double query( const std::vector<double> &inputs ) const;
+  double query( const double * inputs ) const;
+
+  /**
+   *  Batched form of query().  inputs[i] points to the npts values of the
+   *  i-th input variable and result receives npts property values.  This
+   *  method is safe to call concurrently with one workspace per thread.
+   */
+  void query( const int npts,
+              const double * const * inputs,
+              double * result,
+              HDF5TableWorkspace & ws ) const;
 
   /**
    *  Return the property value as a function of the provided input variables.
@@ -105,6 +139,7 @@ class HDF5Table
    *  @result : The property as a function of the inputs
    */
   double raw_query( const std::vector<double> &inputs ) const;
+  double raw_query( const double * inputs ) const;
 
   /** Set the number of clipping events we want to log */
   void set_clipping_log_size( unsigned int size ) ;
@@ -152,8 +187,11 @@ class HDF5Table
 
  private:
 
-  // Add the current values to the clipping event log
-  void log_clip_event( const std::vector<double> & values ) const;
+  // Add the current values to the clipping event log; clipMutex_ must be held
+  void log_clip_event( const double * values ) const;
+
+  // Gather the table inputs of a single point, evaluating any converters
+  void set_lookup_inputs( const double * inputs, double * lookupBuffer ) const;
 
   /** Rewire the inputs and outputs of the Table and any optional Converters
    *  so that they talk to each other properly and inputs to the HDF5Table will
@@ -228,20 +266,12 @@ class HDF5Table
   // Internal interpolator used to perform table lookups
   BSpline * spline_;
 
-  // Buffers for storing clipping diagnostic information
+  // Buffers for storing clipping diagnostic information; clipMutex_
+  // guards them so that queries may run concurrently
   mutable unsigned int clipEventLogSize_;
   mutable unsigned int numClipped_;
   mutable ClipEventLog clipEventLog_;
-
-  // delete this and use lookupBuf_ instead
-  //  double * tableBuf_;
-  //  Scratch space for conversions
-  mutable std::vector<double> converterBuf_;
-
-  // Scratch space for doing log scale conversions, etc. on the input variables
-  mutable std::vector<double> lookupBuffer_;
-  // Scratch space for doing bounds clipping on lookupBuffer_
-  mutable std::vector<double> lookupBufferChecked_;
+  mutable std::mutex clipMutex_;
 
 };
 
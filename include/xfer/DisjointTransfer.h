@@ -0,0 +1,113 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef DisjointTransfer_h
+#define DisjointTransfer_h
+
+#include <mpi.h>
+
+#include <stk_mesh/base/Entity.hpp>
+
+#include <FieldTypeDef.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+// stk
+namespace stk {
+namespace mesh {
+class Part;
+class FieldBase;
+typedef std::vector<Part*> PartVector;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+//==========================================================================
+// Class Definition
+//==========================================================================
+// DisjointTransfer - interpolation between realms that live on different
+//                    sets of processors; the owned "to" nodes are shipped
+//                    to the "from" processors whose parts may hold them and
+//                    the nearest donor returns the interpolated values
+//==========================================================================
+class DisjointTransfer
+{
+public:
+  typedef std::vector<std::pair<std::string, std::string> > PairNames;
+
+  DisjointTransfer(
+    Realm &fromRealm,
+    Realm &toRealm,
+    const stk::mesh::PartVector &fromPartVec,
+    const stk::mesh::PartVector &toPartVec,
+    const PairNames &varPairName,
+    MPI_Comm transferComm,
+    double searchTolerance,
+    double searchExpansionFactor);
+  ~DisjointTransfer();
+
+  // collective over the transfer communicator
+  void initialize();
+  void execute();
+
+private:
+  void exchange(
+    const std::vector<double> &sendBuffer,
+    const std::vector<int> &sendCounts,
+    std::vector<double> &recvBuffer,
+    const std::vector<int> &recvCounts,
+    int stride);
+  void exchange(
+    const std::vector<int> &sendBuffer,
+    const std::vector<int> &sendCounts,
+    std::vector<int> &recvBuffer,
+    const std::vector<int> &recvCounts);
+
+  void find_donors(
+    const std::vector<double> &points,
+    std::vector<double> &distances,
+    std::vector<stk::mesh::Entity> &donors,
+    std::vector<double> &isoParCoords);
+
+  Realm &fromRealm_;
+  Realm &toRealm_;
+  const stk::mesh::PartVector fromPartVec_;
+  const stk::mesh::PartVector toPartVec_;
+  const MPI_Comm transferComm_;
+  const double searchTolerance_;
+  const double searchExpansionFactor_;
+
+  // this processor holds part of the from and/or the to realm
+  const bool isFrom_;
+  const bool isTo_;
+
+  const VectorFieldType *fromCoordinates_;
+  const VectorFieldType *toCoordinates_;
+  std::vector<const stk::mesh::FieldBase *> fromFieldVec_;
+  std::vector<const stk::mesh::FieldBase *> toFieldVec_;
+
+  // from side; donor elements and their isoparametric coordinates ordered by receiving processor
+  std::vector<int> donorCounts_;
+  std::vector<stk::mesh::Entity> donorEntities_;
+  std::vector<double> donorIsoParCoords_;
+
+  // to side; owned nodes ordered by donating processor
+  std::vector<int> receiverCounts_;
+  std::vector<stk::mesh::Entity> receiverNodes_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -241,6 +241,15 @@ public :
     }
   }
 
+  void update_coordinates()
+  {
+    // ghosted nodes need current coordinates before a moving mesh is re-searched
+    if (ghosting_) {
+      std::vector<const stk::mesh::FieldBase *> fields(1, fromcoordinates_);
+      stk::mesh::communicate_field_data( *ghosting_ ,    fields);
+    }
+  }
+
   Entity entity(const EntityKey k) const
   { return fromBulkData_.get_entity(k); }
 
@@ -10,6 +10,7 @@
 #define LinInterp_h
 
 
+#include <iterator>
 #include <string>
 #include <vector>
 #include <utility>
@@ -43,19 +44,34 @@ public :
   static void filter_to_nearest(EntityKeyMap    &RangeToDomain,
       const MeshA     &FromElem,
       MeshB     &ToPoints) ;
+
+  // re-evaluate the retained candidates of each point after mesh motion
+  static void update_nearest(const MeshA &FromElem,
+      MeshB       &ToPoints) ;
+
+  // index of the candidate nearest to the point; candidates.size() if none
+  static size_t find_nearest(const MeshA &FromElem,
+      const MeshB &ToPoints,
+      const EntityKeyB thePt,
+      const std::vector<EntityKeyA> &candidates,
+      double &bestX,
+      std::vector<double> &isoParCoords) ;
     
   static void apply (MeshB         &ToPoints,
       const MeshA         &FromElem,
       const EntityKeyMap &RangeToDomain) ;
 };
 
-template <class FROM, class TO>  void LinInterp<FROM,TO>::filter_to_nearest (
-  EntityKeyMap    &RangeToDomain,
-  const MeshA     &FromElem,
-  MeshB           &ToPoints) {
+template <class FROM, class TO>  size_t LinInterp<FROM,TO>::find_nearest (
+  const MeshA                   &FromElem,
+  const MeshB                   &ToPoints,
+  const EntityKeyB               thePt,
+  const std::vector<EntityKeyA> &candidates,
+  double                        &bestX,
+  std::vector<double>           &isoParCoords) {
 
   const stk::mesh::BulkData &fromBulkData = FromElem.fromBulkData_;
-  stk::mesh::BulkData &toBulkData = ToPoints.toBulkData_;
+  const stk::mesh::BulkData &toBulkData = ToPoints.toBulkData_;
 
   const VectorFieldType *fromcoordinates = FromElem.fromcoordinates_;
   const VectorFieldType *tocoordinates   = ToPoints.tocoordinates_;
@@ -63,6 +79,59 @@ template <class FROM, class TO>  void LinInterp<FROM,TO>::filter_to_nearest (
   // FixMe: Check nDim against Dimension to make sure they are equal
   const unsigned nDim = FromElem.fromMetaData_.spatial_dimension();
 
+  stk::mesh::Entity theNode = toBulkData.get_entity(thePt);
+  // load nodal coordinates from node
+  const double * tocoords = stk::mesh::field_data(*tocoordinates, theNode );
+
+  bestX = std::numeric_limits<double>::max();
+  size_t nearest = candidates.size();
+  std::vector<double> theElementCoords;
+  std::vector<double> candidateIsoParCoords(nDim);
+
+  for (size_t ic = 0; ic < candidates.size(); ++ic) {
+
+    stk::mesh::Entity theElem = fromBulkData.get_entity(candidates[ic]);
+
+    // extract master element from the bucket in which the element resides
+    const stk::mesh::Bucket &theBucket = fromBulkData.bucket(theElem);
+    const stk::topology &theElemTopo = theBucket.topology();
+    MasterElement *meSCS = sierra::nalu::MasterElementRepo::get_surface_master_element(theElemTopo);
+
+    // load nodal coordinates from element
+    stk::mesh::Entity const* elem_node_rels = fromBulkData.begin_nodes(theElem);
+    const int num_nodes = fromBulkData.num_nodes(theElem);
+
+    const int nodesPerElement = meSCS->nodesPerElement_;
+    theElementCoords.resize(nDim*nodesPerElement);
+
+    for ( int ni = 0; ni < num_nodes; ++ni ) { 
+      stk::mesh::Entity node = elem_node_rels[ni];
+
+      // load up vectors
+      const double * fromcoords = stk::mesh::field_data(*fromcoordinates, node );
+      for ( unsigned j = 0; j < nDim; ++j ) { 
+        const int offSet = j*nodesPerElement + ni; 
+        theElementCoords[offSet] = fromcoords[j];
+      }   
+    }   
+
+    const double nearestDistance = meSCS->isInElement(&theElementCoords[0],
+                                                      &(tocoords[0]),
+                                                      &(candidateIsoParCoords[0]));
+    if ( nearestDistance < bestX ) { 
+      bestX        = nearestDistance;    
+      isoParCoords = candidateIsoParCoords;
+      nearest      = ic;
+    }   
+  }
+  return nearest;
+}
+
+template <class FROM, class TO>  void LinInterp<FROM,TO>::filter_to_nearest (
+  EntityKeyMap    &RangeToDomain,
+  const MeshA     &FromElem,
+  MeshB           &ToPoints) {
+
   typedef typename EntityKeyMap::iterator iterator;
   typedef typename EntityKeyMap::const_iterator const_iterator;
 
@@ -70,61 +139,33 @@ template <class FROM, class TO>  void LinInterp<FROM,TO>::filter_to_nearest (
   double maxBestX = -std::numeric_limits<double>::max();
   size_t maxCandidateBoundingBox = 0;
 
-  for (const_iterator current_key=RangeToDomain.begin(); current_key!=RangeToDomain.end(); ) { 
+  std::vector<EntityKeyA> candidates;
+  std::vector<double> isoParCoords;
 
-    double bestX_ = std::numeric_limits<double>::max();
+  for (const_iterator current_key=RangeToDomain.begin(); current_key!=RangeToDomain.end(); ) { 
 
     const stk::mesh::EntityKey thePt  = current_key->first;
-    stk::mesh::Entity theNode = toBulkData.get_entity(thePt);
-    // load nodal coordinates from node
-    const double * tocoords = stk::mesh::field_data(*tocoordinates, theNode );
 
     std::pair<iterator, iterator> keys=RangeToDomain.equal_range(current_key->first);
-    iterator nearest = keys.second;
+    candidates.clear();
+    for (iterator ii=keys.first; ii != keys.second; ++ii)
+      candidates.push_back(ii->second);
+    maxCandidateBoundingBox = std::max(maxCandidateBoundingBox, candidates.size());
 
-    size_t candidateBoundingBoxSize = 0;
-    for (iterator ii=keys.first; ii != keys.second; ++ii) {
-      candidateBoundingBoxSize++;
+    double bestX = 0.0;
+    const size_t nearestIndex = find_nearest(FromElem, ToPoints, thePt, candidates, bestX, isoParCoords);
 
-      const stk::mesh::EntityKey theBox = ii->second; 
-      stk::mesh::Entity theElem = fromBulkData.get_entity(theBox);    
-    
-      // extract master element from the bucket in which the element resides
-      const stk::mesh::Bucket &theBucket = fromBulkData.bucket(theElem);
-      const stk::topology &theElemTopo = theBucket.topology();
-      MasterElement *meSCS = sierra::nalu::MasterElementRepo::get_surface_master_element(theElemTopo);
-
-      // load nodal coordinates from element
-      stk::mesh::Entity const* elem_node_rels = fromBulkData.begin_nodes(theElem);
-      const int num_nodes = fromBulkData.num_nodes(theElem);
-    
-      const int nodesPerElement = meSCS->nodesPerElement_;
-      std::vector<double> theElementCoords(nDim*nodesPerElement);
-
-      for ( int ni = 0; ni < num_nodes; ++ni ) { 
-        stk::mesh::Entity node = elem_node_rels[ni];
-     
-        // load up vectors
-        const double * fromcoords = stk::mesh::field_data(*fromcoordinates, node );
-        for ( unsigned j = 0; j < nDim; ++j ) { 
-          const int offSet = j*nodesPerElement + ni; 
-          theElementCoords[offSet] = fromcoords[j];
-        }   
-      }   
-    
-      std::vector<double> isoParCoords(nDim);
-      const double nearestDistance = meSCS->isInElement(&theElementCoords[0],
-                                                        &(tocoords[0]),
-                                                        &(isoParCoords[0]));
-      if ( nearestDistance < bestX_ ) { 
-        bestX_         = nearestDistance;    
-        ToPoints.TransferInfo_[thePt] = isoParCoords;
-        nearest = ii;
-        maxBestX = std::max(maxBestX, bestX_);
-      }   
+    iterator nearest = keys.second;
+    if ( nearestIndex < candidates.size() ) {
+      ToPoints.TransferInfo_[thePt] = isoParCoords;
+      ToPoints.nearestElement_[thePt] = candidates[nearestIndex];
+      if ( ToPoints.keepCandidates_ )
+        ToPoints.candidates_[thePt] = candidates;
+      maxBestX = std::max(maxBestX, bestX);
+      nearest = keys.first;
+      std::advance(nearest, nearestIndex);
     }
-    maxCandidateBoundingBox = std::max(maxCandidateBoundingBox, candidateBoundingBoxSize);
-  
+
     current_key = keys.second;
     if (nearest != keys.first ) RangeToDomain.erase(keys.first, nearest);
     if (nearest != keys.second) RangeToDomain.erase(++nearest, keys.second);
@@ -143,6 +184,37 @@ template <class FROM, class TO>  void LinInterp<FROM,TO>::filter_to_nearest (
   NaluEnv::self().naluOutputP0() << "  Should max normalized distance and/or candidate bounding box size be too large, please check setup" << std::endl;
  }
 
+template <class FROM, class TO>  void LinInterp<FROM,TO>::update_nearest (
+  const MeshA     &FromElem,
+  MeshB           &ToPoints) {
+
+  double maxBestX = -std::numeric_limits<double>::max();
+  std::vector<double> isoParCoords;
+
+  typename MeshB::CandidateInfo::const_iterator ii;
+  for (ii=ToPoints.candidates_.begin(); ii!=ToPoints.candidates_.end(); ++ii) {
+    const stk::mesh::EntityKey thePt = ii->first;
+    const std::vector<EntityKeyA> &candidates = ii->second;
+
+    double bestX = 0.0;
+    const size_t nearestIndex = find_nearest(FromElem, ToPoints, thePt, candidates, bestX, isoParCoords);
+    if ( nearestIndex < candidates.size() ) {
+      ToPoints.TransferInfo_[thePt] = isoParCoords;
+      ToPoints.nearestElement_[thePt] = candidates[nearestIndex];
+      maxBestX = std::max(maxBestX, bestX);
+    }
+  }
+
+  // points that moved beyond their candidates are extrapolated from the nearest one
+  double g_maxBestX = 0.0;
+  stk::all_reduce_max(FromElem.comm(), &maxBestX, &g_maxBestX, 1);
+  if ( g_maxBestX > 1.0 + 1.0e-6 ) {
+    NaluEnv::self().naluOutputP0()
+      << "XFER::LinInterp::update_nearest() Maximum normalized distance found is: " << g_maxBestX
+      << " (should be unity or less); consider a larger search_tolerance" << std::endl;
+  }
+}
+
 template <class FROM, class TO>  void LinInterp<FROM,TO>::apply 
        (MeshB              &ToPoints,
         const MeshA        &FromElem,
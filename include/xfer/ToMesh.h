@@ -122,7 +122,8 @@ public :
     toPartVec_(toPartVec),
     toFieldVec_   (get_fields(toMetaData, VarPairName)),
     comm_(comm),
-    radius_(radius)   
+    radius_(radius),
+    keepCandidates_(false)
     {
       // nothing to do
     }
@@ -196,6 +197,15 @@ public :
   typedef std::map<stk::mesh::EntityKey, std::vector<double> > TransferInfo;
   TransferInfo TransferInfo_;
 
+  // nearest source element for each point
+  typedef std::map<stk::mesh::EntityKey, stk::mesh::EntityKey> NearestElement;
+  NearestElement nearestElement_;
+
+  // all coarse search candidates for each point; kept for moving meshes only
+  typedef std::map<stk::mesh::EntityKey, std::vector<stk::mesh::EntityKey> > CandidateInfo;
+  bool keepCandidates_;
+  CandidateInfo candidates_;
+
 };
 
 } // namespace nalu
@@ -20,6 +20,10 @@
 #include <boost/shared_ptr.hpp>
 #include <stk_transfer/TransferBase.hpp>
 
+#include <stk_mesh/base/Entity.hpp>
+
+#include <mpi.h>
+
 // stk
 namespace stk {
 namespace mesh {
@@ -34,6 +38,7 @@ namespace nalu{
 class Realm;
 class Transfers;
 class Simulation;
+class DisjointTransfer;
 
 class Transfer
 {
@@ -49,6 +54,9 @@ public:
   void initialize_end();
   void execute();
 
+  // this processor takes part in the transfer
+  bool is_active() const;
+
 
   Simulation *root();
   Transfers *parent();
@@ -82,8 +90,35 @@ public:
   // all of the fields
   std::vector<std::pair<std::string, std::string> > transferVariablesPairName_;
 
+  // apply a cached operator in place of the stk_transfer interpolation
+  bool cacheOperator_;
+  // re-evaluate the operator against the search candidates; moving meshes
+  bool updateOperator_;
+
+  // interpolation operator in compressed rows: target node -> source nodes and weights
+  std::vector<stk::mesh::Entity> operatorTargetNodes_;
+  std::vector<int> operatorRowOffsets_;
+  std::vector<stk::mesh::Entity> operatorSourceNodes_;
+  std::vector<double> operatorWeights_;
+
+  // realms on disjoint processor sets exchange points over transferComm_
+  bool disjointRealms_;
+  MPI_Comm transferComm_;
+  DisjointTransfer *disjointTransfer_;
+
+  // realm rebalance counts at the last search; a change invalidates the search
+  int fromRebalanceCount_;
+  int toRebalanceCount_;
+
   void allocate_stk_transfer();
   void ghost_from_elements();
+
+  bool realms_rebalanced();
+  void reinitialize();
+
+  void build_interpolation_operator();
+  void update_interpolation_operator();
+  void apply_interpolation_operator();
 };
 
 
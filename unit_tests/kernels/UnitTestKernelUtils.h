@@ -230,7 +230,10 @@ public:
   void fill_mesh(bool doPerturb = false)
   {
 
-    unit_test_utils::fill_mesh_1_elem_per_proc_hex8(bulk_);
+    if (meshSpec_.empty())
+      unit_test_utils::fill_mesh_1_elem_per_proc_hex8(bulk_);
+    else
+      unit_test_utils::fill_hex8_mesh(meshSpec_, bulk_);
     if (doPerturb) {
       unit_test_utils::perturb_coord_hex_8(bulk_, 0.125);
     }
@@ -248,6 +251,9 @@ public:
   stk::mesh::BulkData bulk_;
   stk::mesh::PartVector partVec_;
 
+  // optional generated-mesh spec, e.g. "generated:16x16x16"; one hex per proc when empty
+  std::string meshSpec_;
+
   sierra::nalu::SolutionOptions solnOpts_;
 
   const VectorFieldType* coordinates_{nullptr};